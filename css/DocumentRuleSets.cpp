@@ -30,14 +30,172 @@
 #include "DocumentRuleSets.h"
 
 #include "CSSDefaultStyleSheets.h"
+#include "CSSFontSelector.h"
 #include "CSSStyleSheet.h"
 #include "DocumentStyleSheetCollection.h"
 #include "MediaQueryEvaluator.h"
+#include "SecurityOrigin.h"
 #include "StyleResolver.h"
+#include "StyleRule.h"
+#include "StyleRuleImport.h"
 #include "StyleSheetContents.h"
+#include "WebKitCSSKeyframesRule.h"
+#include <wtf/NeverDestroyed.h>
 
 namespace WebCore {
 
+typedef HashMap<StyleSheetContents*, Vector<SharedAuthorRuleSet*>> SharedAuthorRuleSetMap;
+
+// Keyed by the first style sheet the rule set was built from.
+static SharedAuthorRuleSetMap& sharedAuthorRuleSets()
+{
+    static NeverDestroyed<SharedAuthorRuleSetMap> map;
+    return map;
+}
+
+SharedAuthorRuleSet::SharedAuthorRuleSet(Dependencies dependencies)
+    : m_dependencies(WTF::move(dependencies))
+{
+    m_ruleSet.disableAutoShrinkToFit();
+}
+
+PassRefPtr<SharedAuthorRuleSet> SharedAuthorRuleSet::create(Dependencies dependencies)
+{
+    ASSERT(!dependencies.styleSheets.isEmpty());
+    RefPtr<SharedAuthorRuleSet> ruleSet = adoptRef(new SharedAuthorRuleSet(WTF::move(dependencies)));
+    sharedAuthorRuleSets().add(ruleSet->m_dependencies.styleSheets.first().get(), Vector<SharedAuthorRuleSet*>()).iterator->value.append(ruleSet.get());
+    return ruleSet.release();
+}
+
+PassRefPtr<SharedAuthorRuleSet> SharedAuthorRuleSet::find(const Dependencies& dependencies)
+{
+    ASSERT(!dependencies.styleSheets.isEmpty());
+    auto it = sharedAuthorRuleSets().find(dependencies.styleSheets.first().get());
+    if (it == sharedAuthorRuleSets().end())
+        return nullptr;
+    for (auto* ruleSet : it->value) {
+        if (ruleSet->m_dependencies == dependencies)
+            return ruleSet;
+    }
+    return nullptr;
+}
+
+SharedAuthorRuleSet::~SharedAuthorRuleSet()
+{
+    auto it = sharedAuthorRuleSets().find(m_dependencies.styleSheets.first().get());
+    ASSERT(it != sharedAuthorRuleSets().end());
+    Vector<SharedAuthorRuleSet*>& ruleSets = it->value;
+    ruleSets.remove(ruleSets.find(this));
+    if (ruleSets.isEmpty())
+        sharedAuthorRuleSets().remove(it);
+}
+
+static bool collectSharingDependencies(const Vector<RefPtr<StyleRuleBase>>& rules, const MediaQueryEvaluator& medium, SharedAuthorRuleSet::Dependencies& dependencies)
+{
+    for (unsigned i = 0; i < rules.size(); ++i) {
+        StyleRuleBase* rule = rules[i].get();
+        if (rule->isMediaRule()) {
+            StyleRuleMedia* mediaRule = static_cast<StyleRuleMedia*>(rule);
+            if (const MediaQuerySet* mediaQueries = mediaRule->mediaQueries()) {
+                bool result = medium.eval(mediaQueries);
+                dependencies.results.append(std::make_pair(mediaQueries, result));
+                if (!result)
+                    continue;
+            }
+            if (!collectSharingDependencies(mediaRule->childRules(), medium, dependencies))
+                return false;
+        }
+#if ENABLE(CSS_REGIONS)
+        // Region rules hold their own nested rule sets and are not shared.
+        else if (rule->isRegionRule())
+            return false;
+#endif
+#if ENABLE(CSS3_CONDITIONAL_RULES)
+        else if (rule->isSupportsRule() && static_cast<StyleRuleSupports*>(rule)->conditionIsSupported()) {
+            if (!collectSharingDependencies(static_cast<StyleRuleSupports*>(rule)->childRules(), medium, dependencies))
+                return false;
+        }
+#endif
+    }
+    return true;
+}
+
+static bool collectSharingDependencies(StyleSheetContents& sheet, const MediaQueryEvaluator& medium, StyleResolver& resolver, SharedAuthorRuleSet::Dependencies& dependencies)
+{
+    // Sheets modified through the CSSOM are not shared between clients and may change in place.
+    if (sheet.isMutable())
+        return false;
+
+    dependencies.results.append(std::make_pair(&sheet, resolver.document().securityOrigin()->canRequest(sheet.baseURL())));
+    dependencies.styleSheets.append(&sheet);
+
+    const Vector<RefPtr<StyleRuleImport>>& importRules = sheet.importRules();
+    for (unsigned i = 0; i < importRules.size(); ++i) {
+        StyleRuleImport* importRule = importRules[i].get();
+        if (!importRule->styleSheet())
+            continue;
+        if (const MediaQuerySet* mediaQueries = importRule->mediaQueries()) {
+            bool result = medium.eval(mediaQueries);
+            dependencies.results.append(std::make_pair(mediaQueries, result));
+            if (!result)
+                continue;
+        }
+        if (!collectSharingDependencies(*importRule->styleSheet(), medium, resolver, dependencies))
+            return false;
+    }
+
+    return collectSharingDependencies(sheet.childRules(), medium, dependencies);
+}
+
+static bool collectSharingDependencies(const Vector<RefPtr<CSSStyleSheet>>& styleSheets, const MediaQueryEvaluator& medium, StyleResolver& resolver, SharedAuthorRuleSet::Dependencies& dependencies)
+{
+    for (unsigned i = 0; i < styleSheets.size(); ++i) {
+        CSSStyleSheet* cssSheet = styleSheets[i].get();
+        if (cssSheet->mediaQueries() && !medium.eval(cssSheet->mediaQueries()))
+            continue;
+        if (!collectSharingDependencies(cssSheet->contents(), medium, resolver, dependencies))
+            return false;
+    }
+    return !dependencies.styleSheets.isEmpty();
+}
+
+// Registers the rules of a sheet that have effects on the resolver beyond the RuleSet. This is done for each
+// document using a shared RuleSet, and mirrors what RuleSet::addRulesFromSheet() does when building one.
+static void addResolverRules(const Vector<RefPtr<StyleRuleBase>>& rules, const MediaQueryEvaluator& medium, StyleResolver& resolver)
+{
+    for (unsigned i = 0; i < rules.size(); ++i) {
+        StyleRuleBase* rule = rules[i].get();
+        if (rule->isMediaRule()) {
+            StyleRuleMedia* mediaRule = static_cast<StyleRuleMedia*>(rule);
+            if (!mediaRule->mediaQueries() || medium.eval(mediaRule->mediaQueries(), &resolver))
+                addResolverRules(mediaRule->childRules(), medium, resolver);
+        } else if (rule->isFontFaceRule()) {
+            resolver.fontSelector()->addFontFaceRule(static_cast<StyleRuleFontFace*>(rule));
+            resolver.invalidateMatchedPropertiesCache();
+        } else if (rule->isKeyframesRule())
+            resolver.addKeyframeStyle(static_cast<StyleRuleKeyframes*>(rule));
+#if ENABLE(CSS_DEVICE_ADAPTATION)
+        else if (rule->isViewportRule())
+            resolver.viewportStyleResolver()->addViewportRule(static_cast<StyleRuleViewport*>(rule));
+#endif
+#if ENABLE(CSS3_CONDITIONAL_RULES)
+        else if (rule->isSupportsRule() && static_cast<StyleRuleSupports*>(rule)->conditionIsSupported())
+            addResolverRules(static_cast<StyleRuleSupports*>(rule)->childRules(), medium, resolver);
+#endif
+    }
+}
+
+static void addResolverRulesFromSheet(StyleSheetContents& sheet, const MediaQueryEvaluator& medium, StyleResolver& resolver)
+{
+    const Vector<RefPtr<StyleRuleImport>>& importRules = sheet.importRules();
+    for (unsigned i = 0; i < importRules.size(); ++i) {
+        StyleRuleImport* importRule = importRules[i].get();
+        if (importRule->styleSheet() && (!importRule->mediaQueries() || medium.eval(importRule->mediaQueries(), &resolver)))
+            addResolverRulesFromSheet(*importRule->styleSheet(), medium, resolver);
+    }
+    addResolverRules(sheet.childRules(), medium, resolver);
+}
+
 DocumentRuleSets::DocumentRuleSets()
 {
 }
@@ -79,24 +237,49 @@ static std::unique_ptr<RuleSet> makeRuleSet(const Vector<RuleFeature>& rules)
 
 void DocumentRuleSets::resetAuthorStyle()
 {
+    m_sharedAuthorStyle = nullptr;
     m_authorStyle = std::make_unique<RuleSet>();
     m_authorStyle->disableAutoShrinkToFit();
 }
 
 void DocumentRuleSets::appendAuthorStyleSheets(unsigned firstNew, const Vector<RefPtr<CSSStyleSheet>>& styleSheets, MediaQueryEvaluator* medium, InspectorCSSOMWrappers& inspectorCSSOMWrappers, StyleResolver* resolver)
 {
+    // A shared RuleSet is never modified. Appending to it builds this document's author style again from all of its sheets.
+    if (m_sharedAuthorStyle) {
+        resetAuthorStyle();
+        firstNew = 0;
+    }
+
+    bool shouldAddRules = true;
+    if (!firstNew && resolver) {
+        SharedAuthorRuleSet::Dependencies dependencies;
+        if (collectSharingDependencies(styleSheets, *medium, *resolver, dependencies)) {
+            m_sharedAuthorStyle = SharedAuthorRuleSet::find(dependencies);
+            if (m_sharedAuthorStyle)
+                shouldAddRules = false;
+            else
+                m_sharedAuthorStyle = SharedAuthorRuleSet::create(WTF::move(dependencies));
+            m_authorStyle = nullptr;
+        }
+    }
+
     // This handles sheets added to the end of the stylesheet list only. In other cases the style resolver
     // needs to be reconstructed. To handle insertions too the rule order numbers would need to be updated.
+    RuleSet& authorStyle = *this->authorStyle();
     unsigned size = styleSheets.size();
     for (unsigned i = firstNew; i < size; ++i) {
         CSSStyleSheet* cssSheet = styleSheets[i].get();
         ASSERT(!cssSheet->disabled());
         if (cssSheet->mediaQueries() && !medium->eval(cssSheet->mediaQueries(), resolver))
             continue;
-        m_authorStyle->addRulesFromSheet(&cssSheet->contents(), *medium, resolver);
+        if (shouldAddRules)
+            authorStyle.addRulesFromSheet(&cssSheet->contents(), *medium, resolver);
+        else
+            addResolverRulesFromSheet(cssSheet->contents(), *medium, *resolver);
         inspectorCSSOMWrappers.collectFromStyleSheetIfNeeded(cssSheet);
     }
-    m_authorStyle->shrinkToFit();
+    if (shouldAddRules)
+        authorStyle.shrinkToFit();
     collectFeatures();
 }
 
@@ -108,8 +291,8 @@ void DocumentRuleSets::collectFeatures()
     // sharing candidates.
     if (CSSDefaultStyleSheets::defaultStyle)
         m_features.add(CSSDefaultStyleSheets::defaultStyle->features());
-    if (m_authorStyle)
-        m_features.add(m_authorStyle->features());
+    if (RuleSet* authorStyle = this->authorStyle())
+        m_features.add(authorStyle->features());
     if (m_userStyle)
         m_features.add(m_userStyle->features());
 
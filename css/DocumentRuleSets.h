@@ -26,6 +26,7 @@
 #include "RuleFeature.h"
 #include "RuleSet.h"
 #include <memory>
+#include <wtf/RefCounted.h>
 #include <wtf/RefPtr.h>
 #include <wtf/Vector.h>
 
@@ -37,12 +38,39 @@ class DocumentStyleSheetCollection;
 class InspectorCSSOMWrappers;
 class MediaQueryEvaluator;
 class RuleSet;
+class StyleSheetContents;
+
+// An author RuleSet built from immutable style sheets. It is shared by all documents in the process whose
+// active author style sheets have the same contents, media query results and security origin checks.
+class SharedAuthorRuleSet : public RefCounted<SharedAuthorRuleSet> {
+public:
+    // What building the RuleSet depended on, in the order RuleSet::addRulesFromSheet() visits it: each style sheet
+    // with the result of its security origin check, and each media query set with its evaluation result.
+    struct Dependencies {
+        bool operator==(const Dependencies& other) const { return results == other.results; }
+
+        Vector<std::pair<const void*, bool>> results;
+        Vector<RefPtr<StyleSheetContents>> styleSheets;
+    };
+
+    static PassRefPtr<SharedAuthorRuleSet> find(const Dependencies&);
+    static PassRefPtr<SharedAuthorRuleSet> create(Dependencies);
+    ~SharedAuthorRuleSet();
+
+    RuleSet& ruleSet() { return m_ruleSet; }
+
+private:
+    explicit SharedAuthorRuleSet(Dependencies);
+
+    Dependencies m_dependencies;
+    RuleSet m_ruleSet;
+};
 
 class DocumentRuleSets {
 public:
     DocumentRuleSets();
     ~DocumentRuleSets();
-    RuleSet* authorStyle() const { return m_authorStyle.get(); }
+    RuleSet* authorStyle() const { return m_sharedAuthorStyle ? &m_sharedAuthorStyle->ruleSet() : m_authorStyle.get(); }
     RuleSet* userStyle() const { return m_userStyle.get(); }
     RuleFeatureSet& features() { return m_features; }
     const RuleFeatureSet& features() const { return m_features; }
@@ -58,6 +86,7 @@ public:
 private:
     void collectRulesFromUserStyleSheets(const Vector<RefPtr<CSSStyleSheet>>&, RuleSet& userStyle, const MediaQueryEvaluator&, StyleResolver&);
     std::unique_ptr<RuleSet> m_authorStyle;
+    RefPtr<SharedAuthorRuleSet> m_sharedAuthorStyle;
     std::unique_ptr<RuleSet> m_userStyle;
     RuleFeatureSet m_features;
     std::unique_ptr<RuleSet> m_siblingRuleSet;
@@ -388,6 +388,22 @@ static bool device_widthMediaFeatureEval(CSSValue* value, const CSSToLengthConve
     return true;
 }
 
+static int viewportHeight(const FrameView& view, Frame& frame)
+{
+    int height = view.layoutHeight();
+    if (RenderView* renderView = frame.document()->renderView())
+        height = adjustForAbsoluteZoom(height, *renderView);
+    return height;
+}
+
+static int viewportWidth(const FrameView& view, Frame& frame)
+{
+    int width = view.layoutWidth();
+    if (RenderView* renderView = frame.document()->renderView())
+        width = adjustForAbsoluteZoom(width, *renderView);
+    return width;
+}
+
 static bool heightMediaFeatureEval(CSSValue* value, const CSSToLengthConversionData& conversionData, Frame* frame, MediaFeaturePrefix op)
 {
     FrameView* view = frame->view();
@@ -395,11 +411,8 @@ static bool heightMediaFeatureEval(CSSValue* value, const CSSToLengthConversionD
         return false;
 
     if (value) {
-        int height = view->layoutHeight();
-        if (RenderView* renderView = frame->document()->renderView())
-            height = adjustForAbsoluteZoom(height, *renderView);
         int length;
-        return computeLength(value, !frame->document()->inQuirksMode(), conversionData, length) && compareValue(height, length, op);
+        return computeLength(value, !frame->document()->inQuirksMode(), conversionData, length) && compareValue(viewportHeight(*view, *frame), length, op);
     }
 
     return view->layoutHeight() != 0;
@@ -412,11 +425,8 @@ static bool widthMediaFeatureEval(CSSValue* value, const CSSToLengthConversionDa
         return false;
 
     if (value) {
-        int width = view->layoutWidth();
-        if (RenderView* renderView = frame->document()->renderView())
-            width = adjustForAbsoluteZoom(width, *renderView);
         int length;
-        return computeLength(value, !frame->document()->inQuirksMode(), conversionData, length) && compareValue(width, length, op);
+        return computeLength(value, !frame->document()->inQuirksMode(), conversionData, length) && compareValue(viewportWidth(*view, *frame), length, op);
     }
 
     return view->layoutWidth() != 0;
@@ -734,4 +744,42 @@ bool MediaQueryEvaluator::eval(const MediaQueryExp* expr) const
     return false;
 }
 
+bool MediaQueryEvaluator::viewportBreakpoint(const MediaQueryExp* expr, ViewportDimension& dimension, int& breakpoint) const
+{
+    if (!m_frame || !m_frame->view() || !m_style)
+        return false;
+
+    CSSValue* value = expr->value();
+    if (!expr->isValid() || !value || !value->isPrimitiveValue())
+        return false;
+
+    AtomicString mediaFeature = expr->mediaFeature();
+    if (mediaFeature == widthMediaFeature || mediaFeature == min_widthMediaFeature || mediaFeature == max_widthMediaFeature)
+        dimension = ViewportDimension::Width;
+    else if (mediaFeature == heightMediaFeature || mediaFeature == min_heightMediaFeature || mediaFeature == max_heightMediaFeature)
+        dimension = ViewportDimension::Height;
+    else
+        return false;
+
+    // Root em lengths depend on the root element style and viewport-percentage lengths on the viewport size itself.
+    CSSPrimitiveValue* primitiveValue = toCSSPrimitiveValue(value);
+    if (primitiveValue->primitiveType() == CSSPrimitiveValue::CSS_REMS || primitiveValue->isViewportPercentageLength())
+        return false;
+
+    CSSToLengthConversionData conversionData(m_style.get(),
+        m_frame->document()->documentElement()->renderStyle(),
+        m_frame->document()->renderView(), 1, false);
+    return computeLength(value, !m_frame->document()->inQuirksMode(), conversionData, breakpoint);
+}
+
+int MediaQueryEvaluator::viewportDimension(ViewportDimension dimension) const
+{
+    if (!m_frame || !m_frame->view())
+        return 0;
+
+    if (dimension == ViewportDimension::Width)
+        return viewportWidth(*m_frame->view(), *m_frame);
+    return viewportHeight(*m_frame->view(), *m_frame);
+}
+
 } // namespace
@@ -79,6 +79,18 @@ public:
     /** Evaluates media query subexpression, ie "and (media-feature: value)" part */
     bool eval(const MediaQueryExp*) const;
 
+    enum class ViewportDimension { Width, Height };
+
+    /** Computes the length a width or height subexpression compares the viewport against, so that
+     *  callers can tell whether a resize crosses it without evaluating the subexpression again.
+     *  Returns false for other subexpressions, and for lengths that may change without the media
+     *  queries being reevaluated (rem and viewport-percentage units).
+     */
+    bool viewportBreakpoint(const MediaQueryExp*, ViewportDimension&, int& breakpoint) const;
+
+    /** Returns the viewport width or height the way width and height subexpressions see it */
+    int viewportDimension(ViewportDimension) const;
+
 private:
     String m_mediaType;
     Frame* m_frame; // not owned
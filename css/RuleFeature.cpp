@@ -30,6 +30,7 @@
 #include "RuleFeature.h"
 
 #include "CSSSelector.h"
+#include "CSSSelectorList.h"
 
 namespace WebCore {
 
@@ -59,6 +60,107 @@ void RuleFeatureSet::collectFeaturesFromSelector(const CSSSelector* selector)
     }
 }
 
+void DescendantInvalidationSet::add(const DescendantInvalidationSet& other)
+{
+    invalidatesWholeSubtree = invalidatesWholeSubtree || other.invalidatesWholeSubtree;
+    if (invalidatesWholeSubtree) {
+        ids.clear();
+        classes.clear();
+        tagNames.clear();
+        return;
+    }
+    for (auto* id : other.ids)
+        ids.add(id);
+    for (auto* className : other.classes)
+        classes.add(className);
+    for (auto* tagName : other.tagNames)
+        tagNames.add(tagName);
+}
+
+static DescendantInvalidationSet& ensureInvalidationSet(RuleFeatureSet::InvalidationSetMap& map, AtomicStringImpl* key)
+{
+    std::unique_ptr<DescendantInvalidationSet>& invalidationSet = map.add(key, nullptr).iterator->value;
+    if (!invalidationSet)
+        invalidationSet = std::make_unique<DescendantInvalidationSet>();
+    return *invalidationSet;
+}
+
+static void addSubjectToInvalidationSet(DescendantInvalidationSet& invalidationSet, const CSSSelector* subject, bool invalidatesWholeSubtree)
+{
+    if (invalidationSet.invalidatesWholeSubtree)
+        return;
+    if (invalidatesWholeSubtree || !subject) {
+        invalidationSet.invalidatesWholeSubtree = true;
+        invalidationSet.ids.clear();
+        invalidationSet.classes.clear();
+        invalidationSet.tagNames.clear();
+        return;
+    }
+    if (subject->m_match == CSSSelector::Id)
+        invalidationSet.ids.add(subject->value().impl());
+    else if (subject->m_match == CSSSelector::Class)
+        invalidationSet.classes.add(subject->value().impl());
+    else
+        invalidationSet.tagNames.add(subject->tagQName().localName().impl());
+}
+
+static void addInvalidationSetForAncestorFeature(RuleFeatureSet& features, const CSSSelector* selector, const CSSSelector* subject, bool invalidatesWholeSubtree)
+{
+    if (selector->m_match == CSSSelector::Id)
+        addSubjectToInvalidationSet(ensureInvalidationSet(features.idInvalidationSets, selector->value().impl()), subject, invalidatesWholeSubtree);
+    else if (selector->m_match == CSSSelector::Class)
+        addSubjectToInvalidationSet(ensureInvalidationSet(features.classInvalidationSets, selector->value().impl()), subject, invalidatesWholeSubtree);
+    else if (selector->isAttributeSelector())
+        addSubjectToInvalidationSet(ensureInvalidationSet(features.attributeInvalidationSets, selector->attribute().localName().impl()), subject, invalidatesWholeSubtree);
+}
+
+void RuleFeatureSet::collectInvalidationSetsFromSelector(const CSSSelector* rightmostSelector)
+{
+    // The subject compound is keyed by its most selective simple selector: an id, then a class, then a tag name.
+    // A change to a feature of the subject compound only affects the element itself, so only the compounds
+    // to the left of the first combinator produce invalidation sets.
+    const CSSSelector* subject = nullptr;
+    const CSSSelector* selector = rightmostSelector;
+    for (; selector; selector = selector->tagHistory()) {
+        if (selector->m_match == CSSSelector::Id)
+            subject = selector;
+        else if (selector->m_match == CSSSelector::Class && (!subject || subject->m_match == CSSSelector::Tag))
+            subject = selector;
+        else if (selector->m_match == CSSSelector::Tag && !subject && selector->tagQName().localName() != starAtom)
+            subject = selector;
+        if (selector->relation() != CSSSelector::SubSelector)
+            break;
+    }
+    if (!selector)
+        return;
+
+    // Sibling combinators and shadow boundaries can make a feature affect elements outside the subtree
+    // of the element it changed on, so those fall back to restyling the whole subtree.
+    bool invalidatesWholeSubtree = false;
+    CSSSelector::Relation relation = selector->relation();
+    for (selector = selector->tagHistory(); selector; selector = selector->tagHistory()) {
+        if (relation == CSSSelector::DirectAdjacent || relation == CSSSelector::IndirectAdjacent || relation == CSSSelector::ShadowDescendant)
+            invalidatesWholeSubtree = true;
+
+        addInvalidationSetForAncestorFeature(*this, selector, subject, invalidatesWholeSubtree);
+        if (const CSSSelectorList* selectorList = selector->selectorList()) {
+            for (const CSSSelector* subSelector = selectorList->first(); subSelector; subSelector = CSSSelectorList::next(subSelector)) {
+                for (const CSSSelector* simpleSelector = subSelector; simpleSelector; simpleSelector = simpleSelector->tagHistory())
+                    addInvalidationSetForAncestorFeature(*this, simpleSelector, subject, invalidatesWholeSubtree);
+            }
+        }
+
+        if (selector->relation() != CSSSelector::SubSelector)
+            relation = selector->relation();
+    }
+}
+
+static void addInvalidationSets(RuleFeatureSet::InvalidationSetMap& map, const RuleFeatureSet::InvalidationSetMap& other)
+{
+    for (auto& keyValue : other)
+        ensureInvalidationSet(map, keyValue.key).add(*keyValue.value);
+}
+
 void RuleFeatureSet::add(const RuleFeatureSet& other)
 {
     HashSet<AtomicStringImpl*>::const_iterator end = other.idsInRules.end();
@@ -70,6 +172,9 @@ void RuleFeatureSet::add(const RuleFeatureSet& other)
     end = other.attrsInRules.end();
     for (HashSet<AtomicStringImpl*>::const_iterator it = other.attrsInRules.begin(); it != end; ++it)
         attrsInRules.add(*it);
+    addInvalidationSets(idInvalidationSets, other.idInvalidationSets);
+    addInvalidationSets(classInvalidationSets, other.classInvalidationSets);
+    addInvalidationSets(attributeInvalidationSets, other.attributeInvalidationSets);
     siblingRules.appendVector(other.siblingRules);
     uncommonAttributeRules.appendVector(other.uncommonAttributeRules);
     usesFirstLineRules = usesFirstLineRules || other.usesFirstLineRules;
@@ -82,6 +187,9 @@ void RuleFeatureSet::clear()
     idsInRules.clear();
     classesInRules.clear();
     attrsInRules.clear();
+    idInvalidationSets.clear();
+    classInvalidationSets.clear();
+    attributeInvalidationSets.clear();
     siblingRules.clear();
     uncommonAttributeRules.clear();
     usesFirstLineRules = false;
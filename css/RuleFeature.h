@@ -44,6 +44,23 @@ struct RuleFeature {
     bool hasDocumentSecurityOrigin;
 };
 
+// Describes which descendants of an element must be restyled when a feature (an id, a class or
+// an attribute) changes on that element. Descendants are matched by the key of the subject compound
+// of the selectors that use the feature in an ancestor position.
+struct DescendantInvalidationSet {
+    DescendantInvalidationSet()
+        : invalidatesWholeSubtree(false)
+    { }
+
+    void add(const DescendantInvalidationSet&);
+    bool isEmpty() const { return !invalidatesWholeSubtree && ids.isEmpty() && classes.isEmpty() && tagNames.isEmpty(); }
+
+    HashSet<AtomicStringImpl*> ids;
+    HashSet<AtomicStringImpl*> classes;
+    HashSet<AtomicStringImpl*> tagNames;
+    bool invalidatesWholeSubtree;
+};
+
 struct RuleFeatureSet {
     RuleFeatureSet()
         : usesFirstLineRules(false)
@@ -55,10 +72,16 @@ struct RuleFeatureSet {
     void clear();
 
     void collectFeaturesFromSelector(const CSSSelector*);
+    void collectInvalidationSetsFromSelector(const CSSSelector* rightmostSelector);
+
+    typedef HashMap<AtomicStringImpl*, std::unique_ptr<DescendantInvalidationSet>> InvalidationSetMap;
 
     HashSet<AtomicStringImpl*> idsInRules;
     HashSet<AtomicStringImpl*> classesInRules;
     HashSet<AtomicStringImpl*> attrsInRules;
+    InvalidationSetMap idInvalidationSets;
+    InvalidationSetMap classInvalidationSets;
+    InvalidationSetMap attributeInvalidationSets;
     Vector<RuleFeature> siblingRules;
     Vector<RuleFeature> uncommonAttributeRules;
     bool usesFirstLineRules;
@@ -179,6 +179,7 @@ static void collectFeaturesFromRuleData(RuleFeatureSet& features, const RuleData
         } else if (!foundSiblingSelector && selector->isSiblingSelector())
             foundSiblingSelector = true;
     }
+    features.collectInvalidationSetsFromSelector(ruleData.selector());
     if (foundSiblingSelector)
         features.siblingRules.append(RuleFeature(ruleData.rule(), ruleData.selectorIndex(), ruleData.hasDocumentSecurityOrigin()));
     if (ruleData.containsUncommonAttributeSelector())
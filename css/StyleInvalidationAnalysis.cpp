@@ -27,78 +27,154 @@
 #include "StyleInvalidationAnalysis.h"
 
 #include "CSSSelectorList.h"
+#include "CSSValueList.h"
 #include "Document.h"
 #include "ElementIterator.h"
 #include "ElementRuleCollector.h"
+#include "RenderStyle.h"
 #include "SelectorFilter.h"
 #include "StyleRuleImport.h"
 #include "StyleSheetContents.h"
+#include "WebKitCSSKeyframesRule.h"
 
 namespace WebCore {
 
-static bool shouldDirtyAllStyle(const Vector<RefPtr<StyleRuleBase>>& rules)
+StyleInvalidationAnalysis::StyleInvalidationAnalysis(const Vector<StyleSheetContents*>& sheets, const MediaQueryEvaluator& mediaQueryEvaluator, SheetChange sheetChange)
+    : m_sheetChange(sheetChange)
+    , m_dirtiesAllStyle(false)
+    , m_dirtiesAllStyleReason(nullptr)
 {
-    for (auto& rule : rules) {
-        if (rule->isMediaRule()) {
-            if (shouldDirtyAllStyle(static_cast<StyleRuleMedia&>(*rule).childRules()))
-                return true;
-            continue;
-        }
-        // FIXME: At least font faces don't need full recalc in all cases.
-        if (!rule->isStyleRule())
-            return true;
+    for (auto& sheet : sheets) {
+        analyzeStyleSheet(*sheet);
+        if (m_dirtiesAllStyle)
+            return;
     }
-    return false;
+
+    m_ruleSets.resetAuthorStyle();
+    for (auto& sheet : sheets)
+        m_ruleSets.authorStyle()->addRulesFromSheet(sheet, mediaQueryEvaluator);
+
+    // FIXME: We don't descent into shadow trees or otherwise handle shadow pseudo elements.
+    if (m_ruleSets.authorStyle()->hasShadowPseudoElementRules())
+        setDirtiesAllStyle("shadow pseudo element rule");
+}
+
+void StyleInvalidationAnalysis::setDirtiesAllStyle(const char* reason)
+{
+    if (m_dirtiesAllStyle)
+        return;
+    m_dirtiesAllStyle = true;
+    m_dirtiesAllStyleReason = reason;
 }
 
-static bool shouldDirtyAllStyle(const StyleSheetContents& sheet)
+void StyleInvalidationAnalysis::analyzeStyleSheet(const StyleSheetContents& sheet)
 {
     for (auto& import : sheet.importRules()) {
         if (!import->styleSheet())
             continue;
-        if (shouldDirtyAllStyle(*import->styleSheet()))
-            return true;
+        analyzeStyleSheet(*import->styleSheet());
     }
-    if (shouldDirtyAllStyle(sheet.childRules()))
-        return true;
-    return false;
+    analyzeRules(sheet.childRules());
 }
 
-static bool shouldDirtyAllStyle(const Vector<StyleSheetContents*>& sheets)
+void StyleInvalidationAnalysis::analyzeRules(const Vector<RefPtr<StyleRuleBase>>& rules)
 {
-    for (auto& sheet : sheets) {
-        if (shouldDirtyAllStyle(*sheet))
-            return true;
+    for (auto& rule : rules) {
+        if (m_dirtiesAllStyle)
+            return;
+
+        switch (rule->type()) {
+        case StyleRuleBase::Style:
+            // Style rules are matched against the document in invalidateStyle().
+            break;
+        case StyleRuleBase::Page:
+            // Page rules only apply when printing.
+            break;
+        case StyleRuleBase::Media:
+            // Style rules in media blocks that don't match are never added to m_ruleSets so they invalidate nothing.
+            analyzeRules(static_cast<StyleRuleMedia&>(*rule).childRules());
+            break;
+#if ENABLE(CSS3_CONDITIONAL_RULES)
+        case StyleRuleBase::Supports:
+            analyzeRules(static_cast<StyleRuleSupports&>(*rule).childRules());
+            break;
+#endif
+        case StyleRuleBase::Keyframes:
+            // The StyleResolver keeps removed keyframes around until it is reconstructed.
+            if (m_sheetChange == SheetChange::Removal) {
+                setDirtiesAllStyle("removed @keyframes rule");
+                break;
+            }
+            m_keyframesNames.add(static_cast<StyleRuleKeyframes&>(*rule).name());
+            break;
+        case StyleRuleBase::FontFace:
+            // Likewise the CSSFontSelector never forgets a font face.
+            if (m_sheetChange == SheetChange::Removal) {
+                setDirtiesAllStyle("removed @font-face rule");
+                break;
+            }
+            analyzeFontFaceRule(static_cast<StyleRuleFontFace&>(*rule));
+            break;
+        default:
+            setDirtiesAllStyle("region, viewport or unknown rule");
+            break;
+        }
     }
-    return false;
 }
 
-StyleInvalidationAnalysis::StyleInvalidationAnalysis(const Vector<StyleSheetContents*>& sheets, const MediaQueryEvaluator& mediaQueryEvaluator)
-    : m_dirtiesAllStyle(shouldDirtyAllStyle(sheets))
+void StyleInvalidationAnalysis::analyzeFontFaceRule(const StyleRuleFontFace& fontFaceRule)
 {
-    if (m_dirtiesAllStyle)
+    RefPtr<CSSValue> fontFamily = fontFaceRule.properties().getPropertyCSSValue(CSSPropertyFontFamily);
+    // CSSFontSelector ignores font faces without a family list.
+    if (!fontFamily || !fontFamily->isValueList())
         return;
 
-    m_ruleSets.resetAuthorStyle();
-    for (auto& sheet : sheets)
-        m_ruleSets.authorStyle()->addRulesFromSheet(sheet, mediaQueryEvaluator);
+    for (CSSValueListIterator it = fontFamily.get(); it.hasMore(); it.advance()) {
+        CSSValue* item = it.value();
+        if (!item->isPrimitiveValue() || !toCSSPrimitiveValue(item)->isString()) {
+            // A font face for a generic family may apply to any element.
+            setDirtiesAllStyle("@font-face rule for a generic family");
+            return;
+        }
+        m_fontFaceFamilies.add(toCSSPrimitiveValue(item)->getStringValue());
+    }
+}
 
-    // FIXME: We don't descent into shadow trees or otherwise handle shadow pseudo elements.
-    if (m_ruleSets.authorStyle()->hasShadowPseudoElementRules())
-        m_dirtiesAllStyle = true;
+bool StyleInvalidationAnalysis::styleDependsOnChangedResolverRules(const RenderStyle& style) const
+{
+    if (!m_keyframesNames.isEmpty()) {
+        if (const AnimationList* animations = style.animations()) {
+            for (size_t i = 0; i < animations->size(); ++i) {
+                if (m_keyframesNames.contains(animations->animation(i).name()))
+                    return true;
+            }
+        }
+    }
+
+    if (!m_fontFaceFamilies.isEmpty()) {
+        const FontDescription& fontDescription = style.fontDescription();
+        for (unsigned i = 0; i < fontDescription.familyCount(); ++i) {
+            if (m_fontFaceFamilies.contains(fontDescription.familyAt(i)))
+                return true;
+        }
+    }
+
+    return false;
 }
 
-static void invalidateStyleRecursively(Element& element, SelectorFilter& filter, const DocumentRuleSets& ruleSets)
+void StyleInvalidationAnalysis::invalidateStyleRecursively(Element& element, SelectorFilter& filter)
 {
     if (element.styleChangeType() > InlineStyleChange)
         return;
     if (element.styleChangeType() == NoStyleChange) {
-        ElementRuleCollector ruleCollector(element, nullptr, ruleSets, filter);
+        ElementRuleCollector ruleCollector(element, nullptr, m_ruleSets, filter);
         ruleCollector.setMode(SelectorChecker::Mode::StyleInvalidation);
         ruleCollector.matchAuthorRules(false);
 
         if (ruleCollector.hasMatchedRules())
             element.setNeedsStyleRecalc(InlineStyleChange);
+        else if (element.renderStyle() && styleDependsOnChangedResolverRules(*element.renderStyle()))
+            element.setNeedsStyleRecalc(InlineStyleChange);
     }
 
     auto children = childrenOfType<Element>(element);
@@ -106,7 +182,7 @@ static void invalidateStyleRecursively(Element& element, SelectorFilter& filter,
         return;
     filter.pushParent(&element);
     for (auto& child : children)
-        invalidateStyleRecursively(child, filter, ruleSets);
+        invalidateStyleRecursively(child, filter);
     filter.popParent();
 }
 
@@ -122,7 +198,7 @@ void StyleInvalidationAnalysis::invalidateStyle(Document& document)
 
     SelectorFilter filter;
     filter.setupParentStack(documentElement);
-    invalidateStyleRecursively(*documentElement, filter, m_ruleSets);
+    invalidateStyleRecursively(*documentElement, filter);
 }
 
 }
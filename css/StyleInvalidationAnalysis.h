@@ -28,23 +28,45 @@
 
 #include "DocumentRuleSets.h"
 #include <wtf/HashSet.h>
+#include <wtf/text/AtomicStringHash.h>
 #include <wtf/text/AtomicStringImpl.h>
 
 namespace WebCore {
 
 class Document;
+class Element;
+class RenderStyle;
+class SelectorFilter;
+class StyleRuleBase;
+class StyleRuleFontFace;
 class StyleSheetContents;
 
 class StyleInvalidationAnalysis {
 public:
-    StyleInvalidationAnalysis(const Vector<StyleSheetContents*>&, const MediaQueryEvaluator&);
+    enum class SheetChange { Insertion, Removal };
+
+    StyleInvalidationAnalysis(const Vector<StyleSheetContents*>&, const MediaQueryEvaluator&, SheetChange = SheetChange::Insertion);
 
     bool dirtiesAllStyle() const { return m_dirtiesAllStyle; }
+    // Describes the first rule that forced full invalidation, for logging.
+    const char* dirtiesAllStyleReason() const { return m_dirtiesAllStyleReason; }
     void invalidateStyle(Document&);
 
 private:
+    void analyzeStyleSheet(const StyleSheetContents&);
+    void analyzeRules(const Vector<RefPtr<StyleRuleBase>>&);
+    void analyzeFontFaceRule(const StyleRuleFontFace&);
+    void setDirtiesAllStyle(const char* reason);
+
+    void invalidateStyleRecursively(Element&, SelectorFilter&);
+    bool styleDependsOnChangedResolverRules(const RenderStyle&) const;
+
+    SheetChange m_sheetChange;
     bool m_dirtiesAllStyle;
+    const char* m_dirtiesAllStyleReason;
     DocumentRuleSets m_ruleSets;
+    HashSet<AtomicString> m_keyframesNames;
+    HashSet<AtomicString, CaseFoldingHash> m_fontFaceFamilies;
 };
 
 }
@@ -112,6 +112,7 @@
 #include "Settings.h"
 #include "ShadowData.h"
 #include "ShadowRoot.h"
+#include "StyleBuilder.h"
 #include "StyleCachedImage.h"
 #include "StyleFontSizeFunctions.h"
 #include "StyleGeneratedImage.h"
@@ -250,7 +251,9 @@ void StyleResolver::MatchResult::addMatchedProperties(const StyleProperties& pro
 
 StyleResolver::StyleResolver(Document& document, bool matchAuthorAndUserStyles)
     : m_matchedPropertiesCacheAdditionsSinceLastSweep(0)
+    , m_matchedPropertiesCacheGeneration(0)
     , m_matchedPropertiesCacheSweepTimer(this, &StyleResolver::sweepMatchedPropertiesCache)
+    , m_styleSharingIndexEnabled(false)
     , m_document(document)
     , m_matchAuthorAndUserStyles(matchAuthorAndUserStyles)
     , m_fontSelector(CSSFontSelector::create(&m_document))
@@ -433,6 +436,11 @@ inline void StyleResolver::State::setStyle(PassRef<RenderStyle> style)
 
 static const unsigned cStyleSearchThreshold = 10;
 static const unsigned cStyleSearchLevelThreshold = 10;
+static const unsigned cStyleSharingIndexBucketSize = 4;
+
+static unsigned styleSharingAttempts;
+static unsigned styleSharingHits;
+static unsigned styleSharingIndexHits;
 
 static inline bool parentElementPreventsSharing(const Element* parentElement)
 {
@@ -668,6 +676,94 @@ bool StyleResolver::canShareStyleWithElement(StyledElement* element) const
     return true;
 }
 
+bool StyleResolver::parentAllowsCousinSharing(Element* parent) const
+{
+    // These are the checks locateCousinList() makes on the parents it walks through.
+    if (!parent || !parent->isStyledElement())
+        return false;
+    StyledElement* p = toStyledElement(parent);
+    if (p->inlineStyle())
+        return false;
+    if (p->isSVGElement() && toSVGElement(p)->animatedSMILStyleProperties())
+        return false;
+    if (p->hasID() && m_ruleSets.features().idsInRules.contains(p->idForStyleResolution().impl()))
+        return false;
+    return !parentElementPreventsSharing(p);
+}
+
+unsigned StyleResolver::styleSharingIndexKey(StyledElement& element, const RenderStyle* parentStyle)
+{
+    // Candidates that differ in any of these can never share, so they are kept apart. Everything else
+    // is checked by canShareStyleWithElement().
+    const void* key[] = {
+        parentStyle,
+        element.localName().impl(),
+        element.hasClass() ? element.fastGetAttribute(classAttr).impl() : nullptr,
+        element.presentationAttributeStyle()
+    };
+    return StringHasher::hashMemory(key, sizeof(key));
+}
+
+void StyleResolver::setStyleSharingIndexEnabled(bool enabled)
+{
+    m_styleSharingIndexEnabled = enabled;
+    m_styleSharingIndex.clear();
+}
+
+void StyleResolver::addStyleSharingCandidate(StyledElement& element, const RenderStyle* parentStyle)
+{
+    ASSERT(m_styleSharingIndexEnabled);
+    if (element.inlineStyle())
+        return;
+    Vector<RefPtr<StyledElement>, 4>& candidates = m_styleSharingIndex.add(styleSharingIndexKey(element, parentStyle), Vector<RefPtr<StyledElement>, 4>()).iterator->value;
+    if (candidates.size() == cStyleSharingIndexBucketSize)
+        candidates.remove(0);
+    candidates.append(&element);
+}
+
+StyledElement* StyleResolver::findStyleSharingCandidateInIndex()
+{
+    const State& state = m_state;
+    if (!m_styleSharingIndexEnabled)
+        return 0;
+    auto it = m_styleSharingIndex.find(styleSharingIndexKey(*state.styledElement(), state.parentStyle()));
+    if (it == m_styleSharingIndex.end())
+        return 0;
+
+    ContainerNode* parentNode = state.element()->parentNode();
+    bool parentAllowsSharingWithCousins = parentAllowsCousinSharing(state.element()->parentElement());
+    const Vector<RefPtr<StyledElement>, 4>& candidates = it->value;
+    for (unsigned i = candidates.size(); i; --i) {
+        StyledElement* candidate = candidates[i - 1].get();
+        if (candidate == state.element())
+            continue;
+        if (candidate->parentNode() != parentNode) {
+            // A cousin can share if its parent has the very same style, as when found by locateCousinList().
+            Element* candidateParent = candidate->parentElement();
+            if (!parentAllowsSharingWithCousins || !candidateParent || candidateParent->renderStyle() != state.parentStyle() || !parentAllowsCousinSharing(candidateParent))
+                continue;
+        }
+        if (canShareStyleWithElement(candidate))
+            return candidate;
+    }
+    return 0;
+}
+
+unsigned StyleResolver::styleSharingAttemptCount()
+{
+    return styleSharingAttempts;
+}
+
+unsigned StyleResolver::styleSharingHitCount()
+{
+    return styleSharingHits;
+}
+
+unsigned StyleResolver::styleSharingIndexHitCount()
+{
+    return styleSharingIndexHits;
+}
+
 inline StyledElement* StyleResolver::findSiblingForStyleSharing(Node* node, unsigned& count) const
 {
     for (; node; node = node->previousSibling()) {
@@ -706,16 +802,21 @@ RenderStyle* StyleResolver::locateSharedStyle()
     // FIXME: This shouldn't be a member variable. The style sharing code could be factored out of StyleResolver.
     state.setElementAffectedByClassRules(state.element() && state.element()->hasClass() && classNamesAffectedByRules(state.element()->classNames()));
 
-    // Check previous siblings and their cousins.
-    unsigned count = 0;
-    unsigned visitedNodeCount = 0;
-    StyledElement* shareElement = 0;
-    Node* cousinList = state.styledElement()->previousSibling();
-    while (cousinList) {
-        shareElement = findSiblingForStyleSharing(cousinList, count);
-        if (shareElement)
-            break;
-        cousinList = locateCousinList(cousinList->parentElement(), visitedNodeCount);
+    ++styleSharingAttempts;
+
+    StyledElement* shareElement = findStyleSharingCandidateInIndex();
+    bool foundInIndex = shareElement;
+    if (!shareElement) {
+        // Check previous siblings and their cousins.
+        unsigned count = 0;
+        unsigned visitedNodeCount = 0;
+        Node* cousinList = state.styledElement()->previousSibling();
+        while (cousinList) {
+            shareElement = findSiblingForStyleSharing(cousinList, count);
+            if (shareElement)
+                break;
+            cousinList = locateCousinList(cousinList->parentElement(), visitedNodeCount);
+        }
     }
 
     // If we have exhausted all our budget or our cousins.
@@ -731,6 +832,9 @@ RenderStyle* StyleResolver::locateSharedStyle()
     // Tracking child index requires unique style for each node. This may get set by the sibling rule match above.
     if (parentElementPreventsSharing(state.element()->parentElement()))
         return 0;
+    ++styleSharingHits;
+    if (foundInIndex)
+        ++styleSharingIndexHits;
     return shareElement->renderStyle();
 }
 
@@ -762,6 +866,8 @@ PassRef<RenderStyle> StyleResolver::styleForElement(Element* element, RenderStyl
     state.initForStyleResolve(document(), element, defaultParent, regionForStyling);
     if (sharingBehavior == AllowStyleSharing) {
         if (RenderStyle* sharedStyle = locateSharedStyle()) {
+            if (m_styleSharingIndexEnabled)
+                addStyleSharingCandidate(*state.styledElement(), state.parentStyle());
             state.clear();
             return *sharedStyle;
         }
@@ -808,6 +914,9 @@ PassRef<RenderStyle> StyleResolver::styleForElement(Element* element, RenderStyl
     if (state.style()->hasViewportUnits())
         document().setHasStyleWithViewportUnits();
 
+    if (m_styleSharingIndexEnabled && sharingBehavior == AllowStyleSharing && state.styledElement() && state.parentStyle())
+        addStyleSharingCandidate(*state.styledElement(), state.parentStyle());
+
     state.clear(); // Clear out for the next resolve.
 
     // Now return the style.
@@ -1546,27 +1655,62 @@ bool operator!=(const StyleResolver::MatchedProperties& a, const StyleResolver::
     return !(a == b);
 }
 
-const StyleResolver::MatchedPropertiesCacheItem* StyleResolver::findFromMatchedPropertiesCache(unsigned hash, const MatchResult& matchResult)
-{
-    ASSERT(hash);
+// Entries beyond this count are evicted, least recently used first.
+static const unsigned matchedPropertiesCacheCapacity = 4096;
 
-    MatchedPropertiesCache::iterator it = m_matchedPropertiesCache.find(hash);
-    if (it == m_matchedPropertiesCache.end())
-        return 0;
-    MatchedPropertiesCacheItem& cacheItem = it->value;
+static unsigned matchedPropertiesCacheHits;
+static unsigned matchedPropertiesCacheMisses;
 
+bool StyleResolver::matchedPropertiesCacheItemMatches(const MatchedPropertiesCacheItem& cacheItem, const MatchResult& matchResult)
+{
     size_t size = matchResult.matchedProperties.size();
     if (size != cacheItem.matchedProperties.size())
-        return 0;
+        return false;
     for (size_t i = 0; i < size; ++i) {
         if (matchResult.matchedProperties[i] != cacheItem.matchedProperties[i])
-            return 0;
+            return false;
     }
-    if (cacheItem.ranges != matchResult.ranges)
+    return cacheItem.ranges == matchResult.ranges;
+}
+
+const StyleResolver::MatchedPropertiesCacheItem* StyleResolver::findFromMatchedPropertiesCache(unsigned hash, const MatchResult& matchResult)
+{
+    ASSERT(hash);
+
+    MatchedPropertiesCache::iterator it = m_matchedPropertiesCache.find(hash);
+    if (it == m_matchedPropertiesCache.end() || !matchedPropertiesCacheItemMatches(it->value, matchResult)) {
+        ++matchedPropertiesCacheMisses;
         return 0;
+    }
+
+    ++matchedPropertiesCacheHits;
+    MatchedPropertiesCacheItem& cacheItem = it->value;
+    cacheItem.lastUsedGeneration = ++m_matchedPropertiesCacheGeneration;
     return &cacheItem;
 }
 
+void StyleResolver::evictLeastRecentlyUsedMatchedProperties()
+{
+    // Evicting a quarter of the entries at a time keeps the cost of finding them amortized constant per addition.
+    Vector<uint64_t> generations;
+    generations.reserveInitialCapacity(m_matchedPropertiesCache.size());
+    for (auto& cacheKeyValue : m_matchedPropertiesCache)
+        generations.uncheckedAppend(cacheKeyValue.value.lastUsedGeneration);
+    size_t evictionCount = generations.size() / 4;
+    if (!evictionCount)
+        return;
+    std::nth_element(generations.begin(), generations.begin() + evictionCount - 1, generations.end());
+    uint64_t newestEvictedGeneration = generations[evictionCount - 1];
+
+    Vector<unsigned, 16> toRemove;
+    for (auto& cacheKeyValue : m_matchedPropertiesCache) {
+        if (cacheKeyValue.value.lastUsedGeneration <= newestEvictedGeneration)
+            toRemove.append(cacheKeyValue.key);
+    }
+    for (auto key : toRemove)
+        m_matchedPropertiesCache.remove(key);
+}
+
 void StyleResolver::addToMatchedPropertiesCache(const RenderStyle* style, const RenderStyle* parentStyle, unsigned hash, const MatchResult& matchResult)
 {
     static const unsigned matchedDeclarationCacheAdditionsBetweenSweeps = 100;
@@ -1577,6 +1721,9 @@ void StyleResolver::addToMatchedPropertiesCache(const RenderStyle* style, const
     }
 
     ASSERT(hash);
+    if (m_matchedPropertiesCache.size() >= matchedPropertiesCacheCapacity)
+        evictLeastRecentlyUsedMatchedProperties();
+
     MatchedPropertiesCacheItem cacheItem;
     cacheItem.matchedProperties.appendVector(matchResult.matchedProperties);
     cacheItem.ranges = matchResult.ranges;
@@ -1584,6 +1731,7 @@ void StyleResolver::addToMatchedPropertiesCache(const RenderStyle* style, const
     // The RenderStyle in the cache is really just a holder for the substructures and never used as-is.
     cacheItem.renderStyle = RenderStyle::clone(style);
     cacheItem.parentRenderStyle = RenderStyle::clone(parentStyle);
+    cacheItem.lastUsedGeneration = ++m_matchedPropertiesCacheGeneration;
     m_matchedPropertiesCache.add(hash, WTF::move(cacheItem));
 }
 
@@ -1592,6 +1740,26 @@ void StyleResolver::invalidateMatchedPropertiesCache()
     m_matchedPropertiesCache.clear();
 }
 
+size_t StyleResolver::matchedPropertiesCacheSizeInBytes() const
+{
+    // The substructures of the cached styles are mostly shared with live styles, so only the items themselves
+    // and their two RenderStyle holders are counted.
+    size_t size = 0;
+    for (auto& cacheKeyValue : m_matchedPropertiesCache)
+        size += sizeof(MatchedPropertiesCacheItem) + cacheKeyValue.value.matchedProperties.capacity() * sizeof(MatchedProperties) + 2 * sizeof(RenderStyle);
+    return size;
+}
+
+unsigned StyleResolver::matchedPropertiesCacheHitCount()
+{
+    return matchedPropertiesCacheHits;
+}
+
+unsigned StyleResolver::matchedPropertiesCacheMissCount()
+{
+    return matchedPropertiesCacheMisses;
+}
+
 void StyleResolver::clearCachedPropertiesAffectedByViewportUnits()
 {
     Vector<unsigned, 16> toRemove;
@@ -2050,6 +2218,9 @@ void StyleResolver::applyProperty(CSSPropertyID id, CSSValue* value)
     if (isInherit && !state.parentStyle()->hasExplicitlyInheritedProperties() && !CSSProperty::isInheritedProperty(id))
         state.parentStyle()->setHasExplicitlyInheritedProperties();
 
+    if (StyleBuilder::applyProperty(id, *this, *value, isInitial, isInherit))
+        return;
+
     // Check lookup table for implementations and use when available.
     const PropertyHandler& handler = m_deprecatedStyleBuilder.propertyHandler(id);
     if (handler.isValid()) {
@@ -3343,11 +3514,29 @@ Color StyleResolver::colorFromPrimitiveValue(CSSPrimitiveValue* value, bool forV
 
 void StyleResolver::addViewportDependentMediaQueryResult(const MediaQueryExp* expr, bool result)
 {
+    // Width and height expressions only need their breakpoint remembered; a resize that doesn't cross any breakpoint can't change their results.
+    MediaQueryEvaluator::ViewportDimension dimension;
+    int breakpoint;
+    if (m_medium->viewportBreakpoint(expr, dimension, breakpoint)) {
+        ViewportBreakpointRange& range = dimension == MediaQueryEvaluator::ViewportDimension::Width ? m_viewportWidthBreakpointRange : m_viewportHeightBreakpointRange;
+        range.addBreakpoint(breakpoint, m_medium->viewportDimension(dimension));
+        return;
+    }
+
+    for (auto& existingResult : m_viewportDependentMediaQueryResults) {
+        if (existingResult->m_result == result && existingResult->m_expression == *expr)
+            return;
+    }
     m_viewportDependentMediaQueryResults.append(std::make_unique<MediaQueryResult>(*expr, result));
 }
 
 bool StyleResolver::hasMediaQueriesAffectedByViewportChange() const
 {
+    if (!m_viewportWidthBreakpointRange.isUnbounded() && !m_viewportWidthBreakpointRange.contains(m_medium->viewportDimension(MediaQueryEvaluator::ViewportDimension::Width)))
+        return true;
+    if (!m_viewportHeightBreakpointRange.isUnbounded() && !m_viewportHeightBreakpointRange.contains(m_medium->viewportDimension(MediaQueryEvaluator::ViewportDimension::Height)))
+        return true;
+
     unsigned s = m_viewportDependentMediaQueryResults.size();
     for (unsigned i = 0; i < s; i++) {
         if (m_medium->eval(&m_viewportDependentMediaQueryResults[i]->m_expression) != m_viewportDependentMediaQueryResults[i]->m_result)
@@ -38,6 +38,7 @@
 #include "SelectorFilter.h"
 #include "StyleInheritedData.h"
 #include "ViewportStyleResolver.h"
+#include <limits>
 #include <memory>
 #include <wtf/HashMap.h>
 #include <wtf/HashSet.h>
@@ -105,6 +106,36 @@ public:
     bool m_result;
 };
 
+// The open range of sizes a viewport dimension can take without changing the result of any
+// of the width or height media query expressions it was narrowed with.
+class ViewportBreakpointRange {
+public:
+    ViewportBreakpointRange()
+        : m_lowerBound(std::numeric_limits<int>::min())
+        , m_upperBound(std::numeric_limits<int>::max())
+    {
+    }
+
+    void addBreakpoint(int breakpoint, int evaluatedSize)
+    {
+        if (evaluatedSize < breakpoint)
+            m_upperBound = std::min(m_upperBound, breakpoint);
+        else if (evaluatedSize > breakpoint)
+            m_lowerBound = std::max(m_lowerBound, breakpoint);
+        else {
+            m_lowerBound = std::max(m_lowerBound, breakpoint - 1);
+            m_upperBound = std::min(m_upperBound, breakpoint + 1);
+        }
+    }
+
+    bool isUnbounded() const { return m_lowerBound == std::numeric_limits<int>::min() && m_upperBound == std::numeric_limits<int>::max(); }
+    bool contains(int size) const { return size > m_lowerBound && size < m_upperBound; }
+
+private:
+    int m_lowerBound;
+    int m_upperBound;
+};
+
 enum StyleSharingBehavior {
     AllowStyleSharing,
     DisallowStyleSharing,
@@ -171,6 +202,16 @@ public:
 
     const MediaQueryEvaluator& mediaQueryEvaluator() const { return *m_medium; }
 
+    // Resolved elements are indexed as style sharing candidates only while the index is enabled, which is for the
+    // duration of a style recalc of the whole document. Disabling the index releases the candidates.
+    void setStyleSharingIndexEnabled(bool);
+
+    // Statistics on style sharing: elements for which sharing was attempted, elements that got a shared style,
+    // and how many of those found their candidate through the index.
+    static unsigned styleSharingAttemptCount();
+    static unsigned styleSharingHitCount();
+    static unsigned styleSharingIndexHitCount();
+
 private:
     void initElement(Element*);
     RenderStyle* locateSharedStyle();
@@ -178,6 +219,10 @@ private:
     Node* locateCousinList(Element* parent, unsigned& visitedNodeCount) const;
     StyledElement* findSiblingForStyleSharing(Node*, unsigned& count) const;
     bool canShareStyleWithElement(StyledElement*) const;
+    bool parentAllowsCousinSharing(Element* parent) const;
+    static unsigned styleSharingIndexKey(StyledElement&, const RenderStyle* parentStyle);
+    void addStyleSharingCandidate(StyledElement&, const RenderStyle* parentStyle);
+    StyledElement* findStyleSharingCandidateInIndex();
 
     PassRef<RenderStyle> styleForKeyframe(const RenderStyle*, const StyleKeyframe*, KeyframeValue&);
 
@@ -220,7 +265,7 @@ public:
 #endif
 
     void addViewportDependentMediaQueryResult(const MediaQueryExp*, bool result);
-    bool hasViewportDependentMediaQueries() const { return !m_viewportDependentMediaQueryResults.isEmpty(); }
+    bool hasViewportDependentMediaQueries() const { return !m_viewportDependentMediaQueryResults.isEmpty() || !m_viewportWidthBreakpointRange.isUnbounded() || !m_viewportHeightBreakpointRange.isUnbounded(); }
     bool hasMediaQueriesAffectedByViewportChange() const;
 
     void addKeyframeStyle(PassRefPtr<StyleRuleKeyframes>);
@@ -234,6 +279,13 @@ public:
     
     void invalidateMatchedPropertiesCache();
 
+    // Diagnostics for the matched properties cache: the number of entries and their estimated memory use for
+    // this resolver, and lookup hits and misses for all resolvers.
+    unsigned matchedPropertiesCacheSize() const { return m_matchedPropertiesCache.size(); }
+    size_t matchedPropertiesCacheSizeInBytes() const;
+    static unsigned matchedPropertiesCacheHitCount();
+    static unsigned matchedPropertiesCacheMissCount();
+
     void clearCachedPropertiesAffectedByViewportUnits();
 
 #if ENABLE(CSS_FILTERS)
@@ -495,9 +547,12 @@ private:
         MatchRanges ranges;
         RefPtr<RenderStyle> renderStyle;
         RefPtr<RenderStyle> parentRenderStyle;
+        uint64_t lastUsedGeneration;
     };
+    static bool matchedPropertiesCacheItemMatches(const MatchedPropertiesCacheItem&, const MatchResult&);
     const MatchedPropertiesCacheItem* findFromMatchedPropertiesCache(unsigned hash, const MatchResult&);
     void addToMatchedPropertiesCache(const RenderStyle*, const RenderStyle* parentStyle, unsigned hash, const MatchResult&);
+    void evictLeastRecentlyUsedMatchedProperties();
 
     // Every N additions to the matched declaration cache trigger a sweep where entries holding
     // the last reference to a style declaration are garbage collected.
@@ -508,10 +563,18 @@ private:
 
 
     unsigned m_matchedPropertiesCacheAdditionsSinceLastSweep;
+    // Incremented on every lookup hit and addition; entries remember the generation of their last use.
+    // 64 bits so that the counter never wraps and makes recently used entries look old.
+    uint64_t m_matchedPropertiesCacheGeneration;
 
     typedef HashMap<unsigned, MatchedPropertiesCacheItem> MatchedPropertiesCache;
     MatchedPropertiesCache m_matchedPropertiesCache;
 
+    // Most recently resolved elements last, keyed by styleSharingIndexKey().
+    typedef HashMap<unsigned, Vector<RefPtr<StyledElement>, 4>> StyleSharingIndex;
+    StyleSharingIndex m_styleSharingIndex;
+    bool m_styleSharingIndexEnabled;
+
     Timer<StyleResolver> m_matchedPropertiesCacheSweepTimer;
 
     std::unique_ptr<MediaQueryEvaluator> m_medium;
@@ -524,6 +587,8 @@ private:
 
     RefPtr<CSSFontSelector> m_fontSelector;
     Vector<std::unique_ptr<MediaQueryResult>> m_viewportDependentMediaQueryResults;
+    ViewportBreakpointRange m_viewportWidthBreakpointRange;
+    ViewportBreakpointRange m_viewportHeightBreakpointRange;
 
 #if ENABLE(CSS_DEVICE_ADAPTATION)
     RefPtr<ViewportStyleResolver> m_viewportStyleResolver;
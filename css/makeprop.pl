@@ -41,6 +41,15 @@ my $numPredefinedProperties = 1;
 my @names = ();
 my %nameIsInherited;
 my %nameToId;
+my %propertiesWithStyleBuilderOptions;
+my %styleBuilderOptions = (
+  Getter => 1,
+  Initial => 1,
+  NameForMethods => 1,
+  NewStyleBuilder => 1,
+  Setter => 1,
+  TypeName => 1,
+);
 my @aliases = ();
 foreach (@NAMES) {
   next if (m/(^\s*$)/);
@@ -67,8 +76,13 @@ foreach (@NAMES) {
   } else {
     $nameIsInherited{$_} = 0;
     foreach my $option (@options) {
+      my ($optionName, $optionValue) = split(/\s*=\s*/, $option);
       if ($option eq "Inherited") {
         $nameIsInherited{$_} = 1;
+      } elsif ($styleBuilderOptions{$optionName}) {
+        $propertiesWithStyleBuilderOptions{$_}{$optionName} = defined($optionValue) ? $optionValue : 1;
+      } else {
+        die "Unrecognized \"" . $optionName . "\" option for " . $_ . " property.";
       }
     }
 
@@ -304,3 +318,112 @@ close HEADER;
 
 my $gperf = $ENV{GPERF} ? $ENV{GPERF} : "gperf";
 system("\"$gperf\" --key-positions=\"*\" -D -n -s 2 CSSPropertyNames.gperf --output-file=CSSPropertyNames.cpp") == 0 || die "calling gperf failed: $?";
+
+# Properties annotated with the NewStyleBuilder option get specialized apply functions in StyleBuilder.cpp,
+# which StyleResolver calls through a switch instead of DeprecatedStyleBuilder's function pointer table.
+sub getNameForMethods {
+  my $name = shift;
+
+  my $nameForMethods = $nameToId{$name};
+  $nameForMethods =~ s/^Webkit//;
+  if (exists($propertiesWithStyleBuilderOptions{$name}{"NameForMethods"})) {
+    $nameForMethods = $propertiesWithStyleBuilderOptions{$name}{"NameForMethods"};
+  }
+  return $nameForMethods;
+}
+
+sub getStyleBuilderOption {
+  my ($name, $optionName, $defaultValue) = @_;
+
+  if (exists($propertiesWithStyleBuilderOptions{$name}{$optionName})) {
+    return $propertiesWithStyleBuilderOptions{$name}{$optionName};
+  }
+  return $defaultValue;
+}
+
+my @styleBuilderProperties = ();
+foreach my $name (@names) {
+  next unless $propertiesWithStyleBuilderOptions{$name}{"NewStyleBuilder"};
+  die "Property " . $name . " uses the new style builder but has no TypeName option." unless exists($propertiesWithStyleBuilderOptions{$name}{"TypeName"});
+  push @styleBuilderProperties, $name;
+}
+
+open STYLEBUILDER, ">StyleBuilder.cpp" || die "Could not open StyleBuilder.cpp for writing";
+print STYLEBUILDER << "EOF";
+/* This file is automatically generated from CSSPropertyNames.in by makeprop, do not edit */
+
+#include "config.h"
+#include "StyleBuilder.h"
+
+#include "CSSPrimitiveValueMappings.h"
+#include "CSSProperty.h"
+#include "RenderStyle.h"
+#include "StyleResolver.h"
+
+namespace WebCore {
+
+namespace StyleBuilderFunctions {
+
+EOF
+
+my %generatedNamesForMethods;
+foreach my $name (@styleBuilderProperties) {
+  my $nameForMethods = getNameForMethods($name);
+  # Properties sharing a NameForMethods share the same apply functions.
+  next if $generatedNamesForMethods{$nameForMethods};
+  $generatedNamesForMethods{$nameForMethods} = 1;
+
+  my $typeName = getStyleBuilderOption($name, "TypeName");
+  my $getter = getStyleBuilderOption($name, "Getter", lcfirst($nameForMethods));
+  my $setter = getStyleBuilderOption($name, "Setter", "set" . $nameForMethods);
+  my $initial = getStyleBuilderOption($name, "Initial", "initial" . $nameForMethods);
+
+  print STYLEBUILDER "inline void applyInitial" . $nameForMethods . "(StyleResolver& styleResolver)\n";
+  print STYLEBUILDER "{\n";
+  print STYLEBUILDER "    styleResolver.style()->" . $setter . "(RenderStyle::" . $initial . "());\n";
+  print STYLEBUILDER "}\n\n";
+
+  print STYLEBUILDER "inline void applyInherit" . $nameForMethods . "(StyleResolver& styleResolver)\n";
+  print STYLEBUILDER "{\n";
+  print STYLEBUILDER "    styleResolver.style()->" . $setter . "(styleResolver.parentStyle()->" . $getter . "());\n";
+  print STYLEBUILDER "}\n\n";
+
+  print STYLEBUILDER "inline void applyValue" . $nameForMethods . "(StyleResolver& styleResolver, CSSValue& value)\n";
+  print STYLEBUILDER "{\n";
+  print STYLEBUILDER "    if (!value.isPrimitiveValue())\n";
+  print STYLEBUILDER "        return;\n";
+  print STYLEBUILDER "    styleResolver.style()->" . $setter . "(static_cast<" . $typeName . ">(toCSSPrimitiveValue(value)));\n";
+  print STYLEBUILDER "}\n\n";
+}
+
+print STYLEBUILDER << "EOF";
+} // namespace StyleBuilderFunctions
+
+bool StyleBuilder::applyProperty(CSSPropertyID property, StyleResolver& styleResolver, CSSValue& value, bool isInitial, bool isInherit)
+{
+    switch (property) {
+EOF
+
+foreach my $name (@styleBuilderProperties) {
+  my $nameForMethods = getNameForMethods($name);
+
+  print STYLEBUILDER "    case CSSProperty" . $nameToId{$name} . ":\n";
+  print STYLEBUILDER "        if (isInitial)\n";
+  print STYLEBUILDER "            StyleBuilderFunctions::applyInitial" . $nameForMethods . "(styleResolver);\n";
+  print STYLEBUILDER "        else if (isInherit)\n";
+  print STYLEBUILDER "            StyleBuilderFunctions::applyInherit" . $nameForMethods . "(styleResolver);\n";
+  print STYLEBUILDER "        else\n";
+  print STYLEBUILDER "            StyleBuilderFunctions::applyValue" . $nameForMethods . "(styleResolver, value);\n";
+  print STYLEBUILDER "        return true;\n";
+}
+
+print STYLEBUILDER << "EOF";
+    default:
+        return false;
+    }
+}
+
+} // namespace WebCore
+EOF
+
+close STYLEBUILDER;
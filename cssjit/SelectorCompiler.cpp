@@ -31,9 +31,11 @@
 
 #include "CSSSelector.h"
 #include "CSSSelectorList.h"
+#include "DocumentStyleSheetCollection.h"
 #include "Element.h"
 #include "ElementData.h"
 #include "ElementRareData.h"
+#include "ElementTraversal.h"
 #include "FunctionCall.h"
 #include "HTMLDocument.h"
 #include "HTMLNames.h"
@@ -47,6 +49,7 @@
 #include "SelectorCheckerTestFunctions.h"
 #include "StackAllocator.h"
 #include "StyledElement.h"
+#include "Text.h"
 #include <JavaScriptCore/GPRInfo.h>
 #include <JavaScriptCore/LinkBuffer.h>
 #include <JavaScriptCore/MacroAssembler.h>
@@ -164,6 +167,7 @@ struct SelectorFragment {
     Vector<JSC::FunctionPtr, 32> unoptimizedPseudoClasses;
     Vector<AttributeMatchingInfo, 32> attributes;
     Vector<std::pair<int, int>, 32> nthChildFilters;
+    Vector<const CSSSelector*, 8> structuralPseudoClasses;
     Vector<SelectorFragment> notFilters;
     Vector<Vector<SelectorFragment>> anyFilters;
 
@@ -199,6 +203,7 @@ class SelectorCodeGenerator {
 public:
     SelectorCodeGenerator(const CSSSelector*, SelectorContext);
     SelectorCompilationStatus compile(JSC::VM*, JSC::MacroAssemblerCodeRef&);
+    SelectorCompilationStatus compilationStatus() const;
 
 private:
     static const Assembler::RegisterID returnRegister;
@@ -231,6 +236,8 @@ private:
     void generateElementMatching(Assembler::JumpList& matchingTagNameFailureCases, Assembler::JumpList& matchingPostTagNameFailureCases, const SelectorFragment&);
     void generateElementDataMatching(Assembler::JumpList& failureCases, const SelectorFragment&);
     void generateElementFunctionCallTest(Assembler::JumpList& failureCases, JSC::FunctionPtr);
+    void generateElementFunctionCallTestWithCheckingContext(Assembler::JumpList& failureCases, JSC::FunctionPtr);
+    void generateElementFunctionCallTestWithSelector(Assembler::JumpList& failureCases, JSC::FunctionPtr, const CSSSelector&);
     void generateElementIsActive(Assembler::JumpList& failureCases, const SelectorFragment&);
     void generateElementIsFirstChild(Assembler::JumpList& failureCases, const SelectorFragment&);
     void generateElementIsHovered(Assembler::JumpList& failureCases, const SelectorFragment&);
@@ -249,6 +256,7 @@ private:
     void generateElementHasClasses(Assembler::JumpList& failureCases, const LocalRegister& elementDataAddress, const Vector<const AtomicStringImpl*>& classNames);
     void generateElementIsLink(Assembler::JumpList& failureCases);
     void generateElementIsNthChild(Assembler::JumpList& failureCases, const SelectorFragment&);
+    void generateElementMatchesStructuralPseudoClass(Assembler::JumpList& failureCases, const SelectorFragment&, const CSSSelector&);
     void generateElementMatchesNotPseudoClass(Assembler::JumpList& failureCases, const SelectorFragment&);
     void generateElementMatchesAnyPseudoClass(Assembler::JumpList& failureCases, const SelectorFragment&);
     void generateElementIsRoot(Assembler::JumpList& failureCases);
@@ -315,6 +323,12 @@ SelectorCompilationStatus compileSelector(const CSSSelector* lastSelector, JSC::
     return codeGenerator.compile(vm, codeRef);
 }
 
+SelectorCompilationStatus selectorCompilationStatus(const CSSSelector* lastSelector, SelectorContext selectorContext)
+{
+    SelectorCodeGenerator codeGenerator(lastSelector, selectorContext);
+    return codeGenerator.compilationStatus();
+}
+
 static inline FragmentRelation fragmentRelationForSelectorRelation(CSSSelector::Relation relation)
 {
     switch (relation) {
@@ -431,6 +445,32 @@ static inline FunctionType addPseudoClassType(const CSSSelector& selector, Selec
             return FunctionType::SimpleSelectorChecker;
         return FunctionType::SelectorCheckerWithCheckingContext;
 
+    case CSSSelector::PseudoClassEmpty:
+    case CSSSelector::PseudoClassFirstOfType:
+    case CSSSelector::PseudoClassLastOfType:
+    case CSSSelector::PseudoClassOnlyOfType:
+        fragment.structuralPseudoClasses.append(&selector);
+        if (selectorContext == SelectorContext::QuerySelector)
+            return FunctionType::SimpleSelectorChecker;
+        return FunctionType::SelectorCheckerWithCheckingContext;
+
+    case CSSSelector::PseudoClassNthOfType:
+    case CSSSelector::PseudoClassNthLastChild:
+    case CSSSelector::PseudoClassNthLastOfType:
+        {
+            if (!selector.parseNth())
+                return FunctionType::CannotMatchAnything;
+
+            // The element count is always positive.
+            if (selector.nthA() <= 0 && selector.nthB() < 1)
+                return FunctionType::CannotMatchAnything;
+
+            fragment.structuralPseudoClasses.append(&selector);
+            if (selectorContext == SelectorContext::QuerySelector)
+                return FunctionType::SimpleSelectorChecker;
+            return FunctionType::SelectorCheckerWithCheckingContext;
+        }
+
     case CSSSelector::PseudoClassNthChild:
         {
             if (!selector.parseNth())
@@ -734,6 +774,20 @@ static inline unsigned minimumRegisterRequirements(const SelectorFragmentList& s
     return minimum;
 }
 
+inline SelectorCompilationStatus SelectorCodeGenerator::compilationStatus() const
+{
+    switch (m_functionType) {
+    case FunctionType::SimpleSelectorChecker:
+    case FunctionType::CannotMatchAnything:
+        return SelectorCompilationStatus::SimpleSelectorChecker;
+    case FunctionType::SelectorCheckerWithCheckingContext:
+        return SelectorCompilationStatus::SelectorCheckerWithCheckingContext;
+    case FunctionType::CannotCompile:
+        break;
+    }
+    return SelectorCompilationStatus::CannotCompile;
+}
+
 inline SelectorCompilationStatus SelectorCodeGenerator::compile(JSC::VM* vm, JSC::MacroAssemblerCodeRef& codeRef)
 {
     switch (m_functionType) {
@@ -1780,6 +1834,8 @@ void SelectorCodeGenerator::generateElementMatching(Assembler::JumpList& matchin
         generateElementIsLastChild(matchingPostTagNameFailureCases, fragment);
     if (!fragment.nthChildFilters.isEmpty())
         generateElementIsNthChild(matchingPostTagNameFailureCases, fragment);
+    for (const CSSSelector* selector : fragment.structuralPseudoClasses)
+        generateElementMatchesStructuralPseudoClass(matchingPostTagNameFailureCases, fragment, *selector);
     if (!fragment.notFilters.isEmpty())
         generateElementMatchesNotPseudoClass(matchingPostTagNameFailureCases, fragment);
     if (!fragment.anyFilters.isEmpty())
@@ -2201,6 +2257,31 @@ void SelectorCodeGenerator::generateElementFunctionCallTest(Assembler::JumpList&
     failureCases.append(functionCall.callAndBranchOnBooleanReturnValue(Assembler::Zero));
 }
 
+void SelectorCodeGenerator::generateElementFunctionCallTestWithCheckingContext(Assembler::JumpList& failureCases, JSC::FunctionPtr testFunction)
+{
+    unsigned offsetToCheckingContext = m_stackAllocator.offsetToStackReference(m_checkingContextStackReference);
+    Assembler::RegisterID checkingContext = m_registerAllocator.allocateRegisterWithPreference(JSC::GPRInfo::argumentGPR1);
+    m_assembler.loadPtr(Assembler::Address(Assembler::stackPointerRegister, offsetToCheckingContext), checkingContext);
+    m_registerAllocator.deallocateRegister(checkingContext);
+
+    FunctionCall functionCall(m_assembler, m_registerAllocator, m_stackAllocator, m_functionCalls);
+    functionCall.setFunctionAddress(testFunction);
+    functionCall.setTwoArguments(elementAddressRegister, checkingContext);
+    failureCases.append(functionCall.callAndBranchOnBooleanReturnValue(Assembler::Zero));
+}
+
+void SelectorCodeGenerator::generateElementFunctionCallTestWithSelector(Assembler::JumpList& failureCases, JSC::FunctionPtr testFunction, const CSSSelector& selector)
+{
+    LocalRegisterWithPreference selectorRegister(m_registerAllocator, JSC::GPRInfo::argumentGPR1);
+    m_assembler.move(Assembler::TrustedImmPtr(&selector), selectorRegister);
+
+    Assembler::RegisterID elementAddress = elementAddressRegister;
+    FunctionCall functionCall(m_assembler, m_registerAllocator, m_stackAllocator, m_functionCalls);
+    functionCall.setFunctionAddress(testFunction);
+    functionCall.setTwoArguments(elementAddress, selectorRegister);
+    failureCases.append(functionCall.callAndBranchOnBooleanReturnValue(Assembler::Zero));
+}
+
 static void setFirstChildState(Element* element)
 {
     if (RenderStyle* style = element->renderStyle())
@@ -2699,6 +2780,157 @@ void SelectorCodeGenerator::generateElementIsNthChild(Assembler::JumpList& failu
     }
 }
 
+static bool elementIsEmpty(Element* element)
+{
+    for (Node* child = element->firstChild(); child; child = child->nextSibling()) {
+        if (child->isElementNode())
+            return false;
+        if (child->isTextNode() && !toText(child)->data().isEmpty())
+            return false;
+    }
+    return true;
+}
+
+static bool elementIsEmptyForStyleResolution(Element* element, const CheckingContext* checkingContext)
+{
+    bool result = elementIsEmpty(element);
+    if (checkingContext->resolvingMode == SelectorChecker::Mode::ResolvingStyle) {
+        element->setStyleAffectedByEmpty();
+        if (RenderStyle* style = element->renderStyle()) {
+            if (element->document().styleSheetCollection().usesSiblingRules() || style->unique())
+                style->setEmptyState(result);
+        }
+    }
+    return result;
+}
+
+static bool subjectElementIsEmptyForStyleResolution(Element* element, const CheckingContext* checkingContext)
+{
+    bool result = elementIsEmpty(element);
+    if (checkingContext->resolvingMode == SelectorChecker::Mode::ResolvingStyle) {
+        element->setStyleAffectedByEmpty();
+        if (checkingContext->elementStyle)
+            checkingContext->elementStyle->setEmptyState(result);
+    }
+    return result;
+}
+
+static bool isFirstOfType(Element* element)
+{
+    if (!element->parentElement())
+        return false;
+    for (const Element* sibling = ElementTraversal::previousSibling(element); sibling; sibling = ElementTraversal::previousSibling(sibling)) {
+        if (sibling->hasTagName(element->tagQName()))
+            return false;
+    }
+    return true;
+}
+
+static bool isLastOfType(Element* element)
+{
+    Element* parentElement = element->parentElement();
+    if (!parentElement || !parentElement->isFinishedParsingChildren())
+        return false;
+    for (const Element* sibling = ElementTraversal::nextSibling(element); sibling; sibling = ElementTraversal::nextSibling(sibling)) {
+        if (sibling->hasTagName(element->tagQName()))
+            return false;
+    }
+    return true;
+}
+
+static bool isOnlyOfType(Element* element)
+{
+    return isFirstOfType(element) && isLastOfType(element);
+}
+
+static bool isNthOfType(Element* element, const CSSSelector* selector)
+{
+    if (!element->parentElement())
+        return false;
+    int count = 1;
+    for (const Element* sibling = ElementTraversal::previousSibling(element); sibling; sibling = ElementTraversal::previousSibling(sibling)) {
+        if (sibling->hasTagName(element->tagQName()))
+            ++count;
+    }
+    return selector->matchNth(count);
+}
+
+static bool isNthLastChild(Element* element, const CSSSelector* selector)
+{
+    Element* parentElement = element->parentElement();
+    if (!parentElement || !parentElement->isFinishedParsingChildren())
+        return false;
+    int count = 1;
+    for (const Element* sibling = ElementTraversal::nextSibling(element); sibling; sibling = ElementTraversal::nextSibling(sibling))
+        ++count;
+    return selector->matchNth(count);
+}
+
+static bool isNthLastOfType(Element* element, const CSSSelector* selector)
+{
+    Element* parentElement = element->parentElement();
+    if (!parentElement || !parentElement->isFinishedParsingChildren())
+        return false;
+    int count = 1;
+    for (const Element* sibling = ElementTraversal::nextSibling(element); sibling; sibling = ElementTraversal::nextSibling(sibling)) {
+        if (sibling->hasTagName(element->tagQName()))
+            ++count;
+    }
+    return selector->matchNth(count);
+}
+
+static void setChildrenAffectedByBackwardPositionalRules(Element* element)
+{
+    element->setChildrenAffectedByBackwardPositionalRules();
+}
+
+static void setChildrenAffectedByForwardAndBackwardPositionalRules(Element* element)
+{
+    element->setChildrenAffectedByForwardPositionalRules();
+    element->setChildrenAffectedByBackwardPositionalRules();
+}
+
+void SelectorCodeGenerator::generateElementMatchesStructuralPseudoClass(Assembler::JumpList& failureCases, const SelectorFragment& fragment, const CSSSelector& selector)
+{
+    // The parent is marked before testing, matching SelectorChecker: the marking is needed whether or not the element matches.
+    switch (selector.pseudoClassType()) {
+    case CSSSelector::PseudoClassEmpty:
+        if (m_selectorContext == SelectorContext::QuerySelector)
+            generateElementFunctionCallTest(failureCases, elementIsEmpty);
+        else if (shouldUseRenderStyleFromCheckingContext(fragment))
+            generateElementFunctionCallTestWithCheckingContext(failureCases, subjectElementIsEmptyForStyleResolution);
+        else
+            generateElementFunctionCallTestWithCheckingContext(failureCases, elementIsEmptyForStyleResolution);
+        break;
+    case CSSSelector::PseudoClassFirstOfType:
+        markParentElementIfResolvingStyle(Element::setChildrenAffectedByForwardPositionalRules);
+        generateElementFunctionCallTest(failureCases, isFirstOfType);
+        break;
+    case CSSSelector::PseudoClassLastOfType:
+        markParentElementIfResolvingStyle(setChildrenAffectedByBackwardPositionalRules);
+        generateElementFunctionCallTest(failureCases, isLastOfType);
+        break;
+    case CSSSelector::PseudoClassOnlyOfType:
+        markParentElementIfResolvingStyle(setChildrenAffectedByForwardAndBackwardPositionalRules);
+        generateElementFunctionCallTest(failureCases, isOnlyOfType);
+        break;
+    case CSSSelector::PseudoClassNthOfType:
+        markParentElementIfResolvingStyle(Element::setChildrenAffectedByForwardPositionalRules);
+        generateElementFunctionCallTestWithSelector(failureCases, isNthOfType, selector);
+        break;
+    case CSSSelector::PseudoClassNthLastChild:
+        markParentElementIfResolvingStyle(setChildrenAffectedByBackwardPositionalRules);
+        generateElementFunctionCallTestWithSelector(failureCases, isNthLastChild, selector);
+        break;
+    case CSSSelector::PseudoClassNthLastOfType:
+        markParentElementIfResolvingStyle(setChildrenAffectedByBackwardPositionalRules);
+        generateElementFunctionCallTestWithSelector(failureCases, isNthLastOfType, selector);
+        break;
+    default:
+        ASSERT_NOT_REACHED();
+    }
+}
+
 void SelectorCodeGenerator::generateElementMatchesNotPseudoClass(Assembler::JumpList& failureCases, const SelectorFragment& fragment)
 {
     for (const auto& subFragment : fragment.notFilters) {
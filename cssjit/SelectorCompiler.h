@@ -86,6 +86,9 @@ typedef unsigned (*SimpleSelectorChecker)(Element*);
 typedef unsigned (*SelectorCheckerWithCheckingContext)(Element*, const CheckingContext*);
 SelectorCompilationStatus compileSelector(const CSSSelector*, JSC::VM*, SelectorContext, JSC::MacroAssemblerCodeRef& outputCodeRef);
 
+// Returns the status compileSelector() would produce, without generating any code.
+SelectorCompilationStatus selectorCompilationStatus(const CSSSelector*, SelectorContext);
+
 inline SimpleSelectorChecker simpleSelectorCheckerFunction(void* executableAddress, SelectorCompilationStatus compilationStatus)
 {
     ASSERT_UNUSED(compilationStatus, compilationStatus == SelectorCompilationStatus::SimpleSelectorChecker);
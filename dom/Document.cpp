@@ -455,9 +455,6 @@ Document::Document(Frame* frame, const URL& url, unsigned documentClasses, unsig
     , m_xmlStandalone(StandaloneUnspecified)
     , m_hasXMLDeclaration(false)
     , m_designMode(inherit)
-#if !ASSERT_DISABLED
-    , m_inInvalidateNodeListAndCollectionCaches(false)
-#endif
 #if ENABLE(DASHBOARD_SUPPORT)
     , m_hasAnnotatedRegions(false)
     , m_annotatedRegionsDirty(false)
@@ -546,8 +543,11 @@ Document::Document(Frame* frame, const URL& url, unsigned documentClasses, unsig
     initSecurityContext();
     initDNSPrefetch();
 
-    for (unsigned i = 0; i < WTF_ARRAY_LENGTH(m_nodeListAndCollectionCounts); ++i)
+    for (unsigned i = 0; i < WTF_ARRAY_LENGTH(m_nodeListAndCollectionCounts); ++i) {
         m_nodeListAndCollectionCounts[i] = 0;
+        m_documentRootedNodeListAndCollectionCounts[i] = 0;
+        m_nodeListAndCollectionInvalidationVersions[i] = 0;
+    }
 }
 
 #if ENABLE(FULLSCREEN_API)
@@ -632,11 +632,10 @@ Document::~Document()
     if (hasRareData())
         clearRareData();
 
-    ASSERT(!m_listsInvalidatedAtDocument.size());
-    ASSERT(!m_collectionsInvalidatedAtDocument.size());
-
-    for (unsigned i = 0; i < WTF_ARRAY_LENGTH(m_nodeListAndCollectionCounts); ++i)
+    for (unsigned i = 0; i < WTF_ARRAY_LENGTH(m_nodeListAndCollectionCounts); ++i) {
         ASSERT(!m_nodeListAndCollectionCounts[i]);
+        ASSERT(!m_documentRootedNodeListAndCollectionCounts[i]);
+    }
 }
 
 void Document::removedLastRef()
@@ -3488,58 +3487,70 @@ void Document::setCSSTarget(Element* n)
 
 void Document::registerNodeListForInvalidation(LiveNodeList& list)
 {
-    m_nodeListAndCollectionCounts[list.invalidationType()]++;
+    NodeListInvalidationType type = list.invalidationType();
+    m_nodeListAndCollectionCounts[type]++;
     if (!list.isRootedAtDocument())
         return;
-    ASSERT(!list.isRegisteredForInvalidationAtDocument());
-    list.setRegisteredForInvalidationAtDocument(true);
-    m_listsInvalidatedAtDocument.add(&list);
+    m_documentRootedNodeListAndCollectionCounts[type]++;
+    list.setInvalidationVersion(m_nodeListAndCollectionInvalidationVersions[type]);
 }
 
 void Document::unregisterNodeListForInvalidation(LiveNodeList& list)
 {
-    m_nodeListAndCollectionCounts[list.invalidationType()]--;
-    if (!list.isRegisteredForInvalidationAtDocument())
-        return;
-    if (!m_listsInvalidatedAtDocument.size()) {
-        ASSERT(m_inInvalidateNodeListAndCollectionCaches);
-        return;
+    NodeListInvalidationType type = list.invalidationType();
+    if (list.isRootedAtDocument()) {
+        // A stale list was already discounted when its version was bumped.
+        if (list.invalidationVersion() != m_nodeListAndCollectionInvalidationVersions[type])
+            return;
+        ASSERT(m_documentRootedNodeListAndCollectionCounts[type]);
+        m_documentRootedNodeListAndCollectionCounts[type]--;
     }
-    ASSERT(m_listsInvalidatedAtDocument.contains(&list));
-    m_listsInvalidatedAtDocument.remove(&list);
-    list.setRegisteredForInvalidationAtDocument(false);
+    ASSERT(m_nodeListAndCollectionCounts[type]);
+    m_nodeListAndCollectionCounts[type]--;
 }
 
 void Document::registerCollection(HTMLCollection& collection)
 {
-    m_nodeListAndCollectionCounts[collection.invalidationType()]++;
-    if (collection.isRootedAtDocument())
-        m_collectionsInvalidatedAtDocument.add(&collection);
+    NodeListInvalidationType type = collection.invalidationType();
+    m_nodeListAndCollectionCounts[type]++;
+    if (!collection.isRootedAtDocument())
+        return;
+    m_documentRootedNodeListAndCollectionCounts[type]++;
+    collection.setIndexCacheVersion(m_nodeListAndCollectionInvalidationVersions[type]);
 }
 
 void Document::unregisterCollection(HTMLCollection& collection)
 {
-    ASSERT(m_nodeListAndCollectionCounts[collection.invalidationType()]);
-    m_nodeListAndCollectionCounts[collection.invalidationType()]--;
+    NodeListInvalidationType type = collection.invalidationType();
     if (collection.isRootedAtDocument()) {
-        if (!m_collectionsInvalidatedAtDocument.size()) {
-            ASSERT(m_inInvalidateNodeListAndCollectionCaches);
+        if (collection.indexCacheVersion() != m_nodeListAndCollectionInvalidationVersions[type])
             return;
-        }
-        ASSERT(m_collectionsInvalidatedAtDocument.contains(&collection));
-        m_collectionsInvalidatedAtDocument.remove(&collection);
+        ASSERT(m_documentRootedNodeListAndCollectionCounts[type]);
+        m_documentRootedNodeListAndCollectionCounts[type]--;
     }
+    ASSERT(m_nodeListAndCollectionCounts[type]);
+    m_nodeListAndCollectionCounts[type]--;
 }
 
 void Document::collectionCachedIdNameMap(const HTMLCollection& collection)
 {
-    ASSERT_UNUSED(collection, collection.hasNamedElementCache());
+    ASSERT(collection.hasNamedElementCache());
     m_nodeListAndCollectionCounts[InvalidateOnIdNameAttrChange]++;
+    if (!collection.isRootedAtDocument())
+        return;
+    m_documentRootedNodeListAndCollectionCounts[InvalidateOnIdNameAttrChange]++;
+    collection.setNamedElementCacheVersion(m_nodeListAndCollectionInvalidationVersions[InvalidateOnIdNameAttrChange]);
 }
 
 void Document::collectionWillClearIdNameMap(const HTMLCollection& collection)
 {
-    ASSERT_UNUSED(collection, collection.hasNamedElementCache());
+    ASSERT(collection.hasNamedElementCache());
+    if (collection.isRootedAtDocument()) {
+        if (collection.namedElementCacheVersion() != m_nodeListAndCollectionInvalidationVersions[InvalidateOnIdNameAttrChange])
+            return;
+        ASSERT(m_documentRootedNodeListAndCollectionCounts[InvalidateOnIdNameAttrChange]);
+        m_documentRootedNodeListAndCollectionCounts[InvalidateOnIdNameAttrChange]--;
+    }
     ASSERT(m_nodeListAndCollectionCounts[InvalidateOnIdNameAttrChange]);
     m_nodeListAndCollectionCounts[InvalidateOnIdNameAttrChange]--;
 }
@@ -5643,6 +5654,11 @@ void Document::serviceScriptedAnimations(double monotonicAnimationStartTime)
     m_scriptedAnimationController->serviceScriptedAnimations(monotonicAnimationStartTime);
 }
 
+bool Document::hasPendingAnimationFrameCallbacks() const
+{
+    return m_scriptedAnimationController && m_scriptedAnimationController->hasPendingCallbacks();
+}
+
 void Document::clearScriptedAnimationController()
 {
     // FIXME: consider using ActiveDOMObject.
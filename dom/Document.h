@@ -775,6 +775,7 @@ public:
     void collectionWillClearIdNameMap(const HTMLCollection&);
     bool shouldInvalidateNodeListAndCollectionCaches(const QualifiedName* attrName = nullptr) const;
     void invalidateNodeListAndCollectionCaches(const QualifiedName* attrName);
+    uint64_t nodeListAndCollectionInvalidationVersion(NodeListInvalidationType type) const { return m_nodeListAndCollectionInvalidationVersions[type]; }
 
     void attachNodeIterator(NodeIterator*);
     void detachNodeIterator(NodeIterator*);
@@ -1180,6 +1181,7 @@ public:
     int requestAnimationFrame(PassRefPtr<RequestAnimationFrameCallback>);
     void cancelAnimationFrame(int id);
     void serviceScriptedAnimations(double monotonicAnimationStartTime);
+    bool hasPendingAnimationFrameCallbacks() const;
 #endif
 
     void sendWillRevealEdgeEventsIfNeeded(const IntPoint& oldPosition, const IntPoint& newPosition, const IntRect& visibleRect, const IntSize& contentsSize, Element* target = nullptr);
@@ -1504,13 +1506,11 @@ private:
 
     InheritedBool m_designMode;
 
-    HashSet<LiveNodeList*> m_listsInvalidatedAtDocument;
-    HashSet<HTMLCollection*> m_collectionsInvalidatedAtDocument;
-#if !ASSERT_DISABLED
-    bool m_inInvalidateNodeListAndCollectionCaches;
-#endif
-
     unsigned m_nodeListAndCollectionCounts[numNodeListInvalidationTypes];
+    // Caches rooted at the document are not visited on mutation. They remember the version they were
+    // built against and compare it on access; bumping a version drops their share of the counts above.
+    unsigned m_documentRootedNodeListAndCollectionCounts[numNodeListInvalidationTypes];
+    uint64_t m_nodeListAndCollectionInvalidationVersions[numNodeListInvalidationTypes];
 
     RefPtr<XPathEvaluator> m_xpathEvaluator;
 
@@ -33,6 +33,7 @@
 #include "HTMLIFrameElement.h"
 #include "HTMLLinkElement.h"
 #include "HTMLStyleElement.h"
+#include "Logging.h"
 #include "Page.h"
 #include "PageGroup.h"
 #include "ProcessingInstruction.h"
@@ -337,6 +338,26 @@ void DocumentStyleSheetCollection::collectActiveStyleSheets(Vector<RefPtr<StyleS
     }
 }
 
+// Returns false if the change requires a full style recalc.
+static bool invalidateStyleForStyleSheetChange(Document& document, const Vector<StyleSheetContents*>& changedSheets, StyleInvalidationAnalysis::SheetChange sheetChange, const MediaQueryEvaluator& mediaQueryEvaluator)
+{
+    const char* change = sheetChange == StyleInvalidationAnalysis::SheetChange::Removal ? "removal" : "insertion";
+    UNUSED_PARAM(change);
+
+    // If we are already parsing the body and so may have significant amount of elements, put some effort into trying to avoid style recalcs.
+    if (!document.body() || document.hasNodesWithPlaceholderStyle()) {
+        LOG(Styles, "Full style recalc after style sheet %s: no body yet or nodes with placeholder style", change);
+        return false;
+    }
+    StyleInvalidationAnalysis invalidationAnalysis(changedSheets, mediaQueryEvaluator, sheetChange);
+    if (invalidationAnalysis.dirtiesAllStyle()) {
+        LOG(Styles, "Full style recalc after style sheet %s: %s", change, invalidationAnalysis.dirtiesAllStyleReason());
+        return false;
+    }
+    invalidationAnalysis.invalidateStyle(document);
+    return true;
+}
+
 void DocumentStyleSheetCollection::analyzeStyleSheetChange(UpdateFlag updateFlag, const Vector<RefPtr<CSSStyleSheet>>& newStylesheets, StyleResolverUpdateType& styleResolverUpdateType, bool& requiresFullStyleRecalc)
 {
     styleResolverUpdateType = Reconstruct;
@@ -361,10 +382,29 @@ void DocumentStyleSheetCollection::analyzeStyleSheetChange(UpdateFlag updateFlag
         return;
     StyleResolver& styleResolver = *m_document.styleResolverIfExists();
 
-    // Find out which stylesheets are new.
     unsigned oldStylesheetCount = m_activeAuthorStyleSheets.size();
-    if (newStylesheetCount < oldStylesheetCount)
+    if (newStylesheetCount < oldStylesheetCount) {
+        // Find out which stylesheets were removed. Anything but pure removals needs the StyleResolver reconstructed.
+        Vector<StyleSheetContents*> removedSheets;
+        unsigned newIndex = 0;
+        for (unsigned oldIndex = 0; oldIndex < oldStylesheetCount; ++oldIndex) {
+            if (newIndex < newStylesheetCount && m_activeAuthorStyleSheets[oldIndex] == newStylesheets[newIndex]) {
+                ++newIndex;
+                continue;
+            }
+            removedSheets.append(&m_activeAuthorStyleSheets[oldIndex]->contents());
+        }
+        if (newIndex != newStylesheetCount)
+            return;
+        if (!invalidateStyleForStyleSheetChange(m_document, removedSheets, StyleInvalidationAnalysis::SheetChange::Removal, styleResolver.mediaQueryEvaluator()))
+            return;
+        // Removed rules may be anywhere in the author RuleSet so it has to be rebuilt.
+        styleResolverUpdateType = Reset;
+        requiresFullStyleRecalc = false;
         return;
+    }
+
+    // Find out which stylesheets are new.
     Vector<StyleSheetContents*> addedSheets;
     unsigned newIndex = 0;
     for (unsigned oldIndex = 0; oldIndex < oldStylesheetCount; ++oldIndex) {
@@ -387,13 +427,8 @@ void DocumentStyleSheetCollection::analyzeStyleSheetChange(UpdateFlag updateFlag
     // If there were insertions we need to re-add all the stylesheets so rules are ordered correctly.
     styleResolverUpdateType = hasInsertions ? Reset : Additive;
 
-    // If we are already parsing the body and so may have significant amount of elements, put some effort into trying to avoid style recalcs.
-    if (!m_document.body() || m_document.hasNodesWithPlaceholderStyle())
-        return;
-    StyleInvalidationAnalysis invalidationAnalysis(addedSheets, styleResolver.mediaQueryEvaluator());
-    if (invalidationAnalysis.dirtiesAllStyle())
+    if (!invalidateStyleForStyleSheetChange(m_document, addedSheets, StyleInvalidationAnalysis::SheetChange::Insertion, styleResolver.mediaQueryEvaluator()))
         return;
-    invalidationAnalysis.invalidateStyle(m_document);
     requiresFullStyleRecalc = false;
 }
 
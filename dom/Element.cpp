@@ -1062,14 +1062,26 @@ static inline AtomicString makeIdForStyleResolution(const AtomicString& value, b
     return value;
 }
 
-static bool checkNeedsStyleInvalidationForIdChange(const AtomicString& oldId, const AtomicString& newId, StyleResolver* styleResolver)
+static void addInvalidationSet(DescendantInvalidationSet& invalidationSet, const RuleFeatureSet::InvalidationSetMap& invalidationSets, const AtomicString& key)
+{
+    if (const DescendantInvalidationSet* featureInvalidationSet = invalidationSets.get(key.impl()))
+        invalidationSet.add(*featureInvalidationSet);
+}
+
+static bool checkNeedsStyleInvalidationForIdChange(const AtomicString& oldId, const AtomicString& newId, StyleResolver* styleResolver, DescendantInvalidationSet& invalidationSet)
 {
     ASSERT(newId != oldId);
-    if (!oldId.isEmpty() && styleResolver->hasSelectorForId(oldId))
-        return true;
-    if (!newId.isEmpty() && styleResolver->hasSelectorForId(newId))
-        return true;
-    return false;
+    bool needsStyleInvalidation = false;
+    const RuleFeatureSet& features = styleResolver->ruleSets().features();
+    if (!oldId.isEmpty() && styleResolver->hasSelectorForId(oldId)) {
+        addInvalidationSet(invalidationSet, features.idInvalidationSets, oldId);
+        needsStyleInvalidation = true;
+    }
+    if (!newId.isEmpty() && styleResolver->hasSelectorForId(newId)) {
+        addInvalidationSet(invalidationSet, features.idInvalidationSets, newId);
+        needsStyleInvalidation = true;
+    }
+    return needsStyleInvalidation;
 }
 
 void Element::attributeChanged(const QualifiedName& name, const AtomicString& oldValue, const AtomicString& newValue, AttributeModificationReason)
@@ -1084,29 +1096,32 @@ void Element::attributeChanged(const QualifiedName& name, const AtomicString& ol
     StyleResolver* styleResolver = document().styleResolverIfExists();
     bool testShouldInvalidateStyle = inRenderedDocument() && styleResolver && styleChangeType() < FullStyleChange;
     bool shouldInvalidateStyle = false;
+    DescendantInvalidationSet invalidationSet;
 
     if (name == HTMLNames::idAttr) {
         AtomicString oldId = elementData()->idForStyleResolution();
         AtomicString newId = makeIdForStyleResolution(newValue, document().inQuirksMode());
         if (newId != oldId) {
             elementData()->setIdForStyleResolution(newId);
-            shouldInvalidateStyle = testShouldInvalidateStyle && checkNeedsStyleInvalidationForIdChange(oldId, newId, styleResolver);
+            shouldInvalidateStyle = testShouldInvalidateStyle && checkNeedsStyleInvalidationForIdChange(oldId, newId, styleResolver, invalidationSet);
         }
     } else if (name == classAttr)
         classAttributeChanged(newValue);
     else if (name == HTMLNames::nameAttr)
         elementData()->setHasNameAttribute(!newValue.isNull());
-    else if (name == HTMLNames::pseudoAttr)
-        shouldInvalidateStyle |= testShouldInvalidateStyle && isInShadowTree();
+    else if (name == HTMLNames::pseudoAttr && testShouldInvalidateStyle && isInShadowTree()) {
+        shouldInvalidateStyle = true;
+        invalidationSet.invalidatesWholeSubtree = true;
+    }
 
 
     invalidateNodeListAndCollectionCachesInAncestors(&name, this);
 
     // If there is currently no StyleResolver, we can't be sure that this attribute change won't affect style.
-    shouldInvalidateStyle |= !styleResolver;
-
-    if (shouldInvalidateStyle)
+    if (!styleResolver)
         setNeedsStyleRecalc();
+    else if (shouldInvalidateStyle)
+        Style::invalidateStyleForChangedFeatures(*this, invalidationSet);
 
     if (AXObjectCache* cache = document().existingAXObjectCache())
         cache->handleAttributeChanged(name, this);
@@ -1139,21 +1154,29 @@ static inline bool classStringHasClassName(const AtomicString& newClassString)
     return classStringHasClassName(newClassString.characters16(), length);
 }
 
-static bool checkSelectorForClassChange(const SpaceSplitString& changedClasses, const StyleResolver& styleResolver)
+static bool checkSelectorForClassChange(const AtomicString& changedClass, const StyleResolver& styleResolver, DescendantInvalidationSet& invalidationSet)
 {
+    if (!styleResolver.hasSelectorForClass(changedClass))
+        return false;
+    addInvalidationSet(invalidationSet, styleResolver.ruleSets().features().classInvalidationSets, changedClass);
+    return true;
+}
+
+static bool checkSelectorForClassChange(const SpaceSplitString& changedClasses, const StyleResolver& styleResolver, DescendantInvalidationSet& invalidationSet)
+{
+    bool needsStyleInvalidation = false;
     unsigned changedSize = changedClasses.size();
-    for (unsigned i = 0; i < changedSize; ++i) {
-        if (styleResolver.hasSelectorForClass(changedClasses[i]))
-            return true;
-    }
-    return false;
+    for (unsigned i = 0; i < changedSize; ++i)
+        needsStyleInvalidation |= checkSelectorForClassChange(changedClasses[i], styleResolver, invalidationSet);
+    return needsStyleInvalidation;
 }
 
-static bool checkSelectorForClassChange(const SpaceSplitString& oldClasses, const SpaceSplitString& newClasses, const StyleResolver& styleResolver)
+static bool checkSelectorForClassChange(const SpaceSplitString& oldClasses, const SpaceSplitString& newClasses, const StyleResolver& styleResolver, DescendantInvalidationSet& invalidationSet)
 {
     unsigned oldSize = oldClasses.size();
     if (!oldSize)
-        return checkSelectorForClassChange(newClasses, styleResolver);
+        return checkSelectorForClassChange(newClasses, styleResolver, invalidationSet);
+    bool needsStyleInvalidation = false;
     BitVector remainingClassBits;
     remainingClassBits.ensureSize(oldSize);
     // Class vectors tend to be very short. This is faster than using a hash table.
@@ -1168,17 +1191,15 @@ static bool checkSelectorForClassChange(const SpaceSplitString& oldClasses, cons
         }
         if (foundFromBoth)
             continue;
-        if (styleResolver.hasSelectorForClass(newClasses[i]))
-            return true;
+        needsStyleInvalidation |= checkSelectorForClassChange(newClasses[i], styleResolver, invalidationSet);
     }
     for (unsigned i = 0; i < oldSize; ++i) {
         // If the bit is not set the the corresponding class has been removed.
         if (remainingClassBits.quickGet(i))
             continue;
-        if (styleResolver.hasSelectorForClass(oldClasses[i]))
-            return true;
+        needsStyleInvalidation |= checkSelectorForClassChange(oldClasses[i], styleResolver, invalidationSet);
     }
-    return false;
+    return needsStyleInvalidation;
 }
 
 void Element::classAttributeChanged(const AtomicString& newClassString)
@@ -1186,6 +1207,7 @@ void Element::classAttributeChanged(const AtomicString& newClassString)
     StyleResolver* styleResolver = document().styleResolverIfExists();
     bool testShouldInvalidateStyle = inRenderedDocument() && styleResolver && styleChangeType() < FullStyleChange;
     bool shouldInvalidateStyle = false;
+    DescendantInvalidationSet invalidationSet;
 
     if (classStringHasClassName(newClassString)) {
         const bool shouldFoldCase = document().inQuirksMode();
@@ -1195,10 +1217,10 @@ void Element::classAttributeChanged(const AtomicString& newClassString)
         const SpaceSplitString oldClasses = elementData()->classNames();
         elementData()->setClass(newClassString, shouldFoldCase);
         const SpaceSplitString& newClasses = elementData()->classNames();
-        shouldInvalidateStyle = testShouldInvalidateStyle && checkSelectorForClassChange(oldClasses, newClasses, *styleResolver);
+        shouldInvalidateStyle = testShouldInvalidateStyle && checkSelectorForClassChange(oldClasses, newClasses, *styleResolver, invalidationSet);
     } else if (elementData()) {
         const SpaceSplitString& oldClasses = elementData()->classNames();
-        shouldInvalidateStyle = testShouldInvalidateStyle && checkSelectorForClassChange(oldClasses, *styleResolver);
+        shouldInvalidateStyle = testShouldInvalidateStyle && checkSelectorForClassChange(oldClasses, *styleResolver, invalidationSet);
         elementData()->clearClass();
     }
 
@@ -1206,7 +1228,7 @@ void Element::classAttributeChanged(const AtomicString& newClassString)
         elementRareData()->clearClassListValueForQuirksMode();
 
     if (shouldInvalidateStyle)
-        setNeedsStyleRecalc();
+        Style::invalidateStyleForChangedFeatures(*this, invalidationSet);
 }
 
 URL Element::absoluteLinkURL() const
@@ -2754,8 +2776,12 @@ void Element::willModifyAttribute(const QualifiedName& name, const AtomicString&
 
     if (oldValue != newValue) {
         auto styleResolver = document().styleResolverIfExists();
-        if (styleResolver && styleResolver->hasSelectorForAttribute(name.localName()))
-            setNeedsStyleRecalc();
+        bool testShouldInvalidateStyle = inRenderedDocument() && styleResolver && styleChangeType() < FullStyleChange;
+        if (testShouldInvalidateStyle && styleResolver->hasSelectorForAttribute(name.localName())) {
+            DescendantInvalidationSet invalidationSet;
+            addInvalidationSet(invalidationSet, styleResolver->ruleSets().features().attributeInvalidationSets, name.localName());
+            Style::invalidateStyleForChangedFeatures(*this, invalidationSet);
+        }
     }
 
     if (std::unique_ptr<MutationObserverInterestGroup> recipients = MutationObserverInterestGroup::createForAttributesMutation(*this, name))
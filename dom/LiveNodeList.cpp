@@ -34,7 +34,7 @@ namespace WebCore {
 LiveNodeList::LiveNodeList(ContainerNode& ownerNode, NodeListInvalidationType invalidationType)
     : m_ownerNode(ownerNode)
     , m_invalidationType(invalidationType)
-    , m_isRegisteredForInvalidationAtDocument(false)
+    , m_invalidationVersion(0)
 {
     ASSERT(m_invalidationType == static_cast<unsigned>(invalidationType));
 }
@@ -58,8 +58,9 @@ public:
     }
     virtual void invalidateCache(Document&) const = 0;
 
-    bool isRegisteredForInvalidationAtDocument() const { return m_isRegisteredForInvalidationAtDocument; }
-    void setRegisteredForInvalidationAtDocument(bool f) { m_isRegisteredForInvalidationAtDocument = f; }
+    // Only meaningful for lists rooted at the document; see Document::registerNodeListForInvalidation().
+    uint64_t invalidationVersion() const { return m_invalidationVersion; }
+    void setInvalidationVersion(uint64_t version) { m_invalidationVersion = version; }
 
 protected:
     Document& document() const { return m_ownerNode->document(); }
@@ -72,7 +73,7 @@ private:
     Ref<ContainerNode> m_ownerNode;
 
     const unsigned m_invalidationType;
-    bool m_isRegisteredForInvalidationAtDocument;
+    uint64_t m_invalidationVersion;
 };
 
 template <class NodeListType>
@@ -100,6 +101,7 @@ protected:
 
 private:
     ContainerNode& rootNode() const;
+    void invalidateCacheIfStale() const;
 
     mutable CollectionIndexCache<NodeListType, ElementDescendantIterator> m_indexCache;
 };
@@ -224,15 +226,28 @@ void CachedLiveNodeList<NodeListType>::invalidateCache(Document& document) const
     m_indexCache.invalidate(nodeList);
 }
 
+template <class NodeListType>
+inline void CachedLiveNodeList<NodeListType>::invalidateCacheIfStale() const
+{
+    auto& nodeList = static_cast<const NodeListType&>(*this);
+    if (!nodeList.isRootedAtDocument() || !m_indexCache.hasValidCache(nodeList))
+        return;
+    Document& document = this->document();
+    if (invalidationVersion() != document.nodeListAndCollectionInvalidationVersion(invalidationType()))
+        invalidateCache(document);
+}
+
 template <class NodeListType>
 unsigned CachedLiveNodeList<NodeListType>::length() const
 {
+    invalidateCacheIfStale();
     return m_indexCache.nodeCount(static_cast<const NodeListType&>(*this));
 }
 
 template <class NodeListType>
 Node* CachedLiveNodeList<NodeListType>::item(unsigned offset) const
 {
+    invalidateCacheIfStale();
     return m_indexCache.nodeAt(static_cast<const NodeListType&>(*this), offset);
 }
 
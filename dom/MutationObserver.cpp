@@ -38,6 +38,7 @@
 #include "MutationCallback.h"
 #include "MutationObserverRegistration.h"
 #include "MutationRecord.h"
+#include "Settings.h"
 #include <algorithm>
 #include <wtf/MainThread.h>
 
@@ -54,6 +55,12 @@ PassRefPtr<MutationObserver> MutationObserver::create(PassRefPtr<MutationCallbac
 MutationObserver::MutationObserver(PassRefPtr<MutationCallback> callback)
     : m_callback(callback)
     , m_priority(s_observerPriority++)
+    , m_coalescesRecords(false)
+    , m_maximumQueuedRecords(0)
+    , m_recordsDroppedSinceLastDelivery(0)
+    , m_enqueuedRecordCount(0)
+    , m_coalescedRecordCount(0)
+    , m_droppedRecordCount(0)
 {
 }
 
@@ -104,6 +111,11 @@ void MutationObserver::observe(Node* node, const Dictionary& optionsDictionary,
         return;
     }
 
+    if (Settings* settings = node->document().settings()) {
+        m_coalescesRecords = settings->mutationObserverRecordCoalescingEnabled();
+        m_maximumQueuedRecords = settings->maximumQueuedMutationRecords();
+    }
+
     node->registerMutationObserver(this, options, attributeFilter);
 }
 
@@ -117,6 +129,7 @@ Vector<RefPtr<MutationRecord>> MutationObserver::takeRecords()
 void MutationObserver::disconnect()
 {
     m_records.clear();
+    m_recordsDroppedSinceLastDelivery = 0;
     HashSet<MutationObserverRegistration*> registrations(m_registrations);
     for (HashSet<MutationObserverRegistration*>::iterator iter = registrations.begin(); iter != registrations.end(); ++iter)
         MutationObserverRegistration::unregisterAndDelete(*iter);
@@ -148,11 +161,39 @@ static MutationObserverSet& suspendedMutationObservers()
     return suspendedObservers;
 }
 
-void MutationObserver::enqueueMutationRecord(PassRefPtr<MutationRecord> mutation)
+bool MutationObserver::coalescesWithLastQueuedRecord(MutationRecord& mutation)
+{
+    if (m_records.isEmpty())
+        return false;
+
+    // The queued record already reports the oldest value, so a later change of the same kind to the
+    // same target adds nothing that a script could not read from the target itself.
+    MutationRecord& last = *m_records.last();
+    if (last.target() != mutation.target() || last.type() != mutation.type())
+        return false;
+    // Child list records describe distinct insertions and removals and are never coalesced.
+    if (mutation.isChildList())
+        return false;
+    return last.attributeName() == mutation.attributeName() && last.attributeNamespace() == mutation.attributeNamespace();
+}
+
+void MutationObserver::enqueueMutationRecord(PassRefPtr<MutationRecord> prpMutation)
 {
     ASSERT(isMainThread());
-    m_records.append(mutation);
+    RefPtr<MutationRecord> mutation = prpMutation;
+    ++m_enqueuedRecordCount;
     activeMutationObservers().add(this);
+
+    if (m_coalescesRecords && coalescesWithLastQueuedRecord(*mutation)) {
+        ++m_coalescedRecordCount;
+        return;
+    }
+    if (m_maximumQueuedRecords && m_records.size() >= m_maximumQueuedRecords) {
+        ++m_droppedRecordCount;
+        ++m_recordsDroppedSinceLastDelivery;
+        return;
+    }
+    m_records.append(mutation.release());
 }
 
 void MutationObserver::setHasTransientRegistration()
@@ -169,6 +210,18 @@ HashSet<Node*> MutationObserver::getObservedNodes() const
     return observedNodes;
 }
 
+size_t MutationObserver::queuedRecordBytes() const
+{
+    size_t bytes = m_records.capacity() * sizeof(RefPtr<MutationRecord>);
+    for (auto& record : m_records) {
+        String oldValue = record->oldValue();
+        if (oldValue.isNull())
+            continue;
+        bytes += oldValue.is8Bit() ? oldValue.length() * sizeof(LChar) : oldValue.length() * sizeof(UChar);
+    }
+    return bytes;
+}
+
 bool MutationObserver::canDeliver()
 {
     return !m_callback->scriptExecutionContext()->activeDOMObjectsAreSuspended();
@@ -188,6 +241,12 @@ void MutationObserver::deliver()
     for (size_t i = 0; i < transientRegistrations.size(); ++i)
         transientRegistrations[i]->clearTransientRegistrations();
 
+    if (m_recordsDroppedSinceLastDelivery) {
+        m_callback->scriptExecutionContext()->addConsoleMessage(MessageSource::JS, MessageLevel::Warning,
+            "MutationObserver dropped " + String::number(m_recordsDroppedSinceLastDelivery) + " mutation records because its queue was full.");
+        m_recordsDroppedSinceLastDelivery = 0;
+    }
+
     if (m_records.isEmpty())
         return;
 
@@ -88,6 +88,13 @@ public:
 
     HashSet<Node*> getObservedNodes() const;
 
+    // Diagnostics.
+    unsigned enqueuedRecordCount() const { return m_enqueuedRecordCount; }
+    unsigned coalescedRecordCount() const { return m_coalescedRecordCount; }
+    unsigned droppedRecordCount() const { return m_droppedRecordCount; }
+    unsigned queuedRecordCount() const { return m_records.size(); }
+    size_t queuedRecordBytes() const;
+
 private:
     struct ObserverLessThan;
 
@@ -95,11 +102,20 @@ private:
     void deliver();
 
     static bool validateOptions(MutationObserverOptions);
+    bool coalescesWithLastQueuedRecord(MutationRecord&);
 
     RefPtr<MutationCallback> m_callback;
     Vector<RefPtr<MutationRecord>> m_records;
     HashSet<MutationObserverRegistration*> m_registrations;
     unsigned m_priority;
+
+    bool m_coalescesRecords;
+    unsigned m_maximumQueuedRecords;
+    unsigned m_recordsDroppedSinceLastDelivery;
+
+    unsigned m_enqueuedRecordCount;
+    unsigned m_coalescedRecordCount;
+    unsigned m_droppedRecordCount;
 };
 
 }
@@ -143,12 +143,17 @@ private:
     RefPtr<MutationRecord> m_record;
 };
 
-const AtomicString& ChildListRecord::type()
+static const AtomicString& childListType()
 {
     DEPRECATED_DEFINE_STATIC_LOCAL(AtomicString, childList, ("childList", AtomicString::ConstructFromLiteral));
     return childList;
 }
 
+const AtomicString& ChildListRecord::type()
+{
+    return childListType();
+}
+
 const AtomicString& AttributesRecord::type()
 {
     DEPRECATED_DEFINE_STATIC_LOCAL(AtomicString, attributes, ("attributes", AtomicString::ConstructFromLiteral));
@@ -161,6 +166,11 @@ const AtomicString& CharacterDataRecord::type()
     return characterData;
 }
 
+bool MutationRecord::isChildList()
+{
+    return type() == childListType();
+}
+
 } // namespace
 
 PassRefPtr<MutationRecord> MutationRecord::createChildList(ContainerNode& target, PassRefPtr<NodeList> added, PassRefPtr<NodeList> removed, PassRefPtr<Node> previousSibling, PassRefPtr<Node> nextSibling)
@@ -56,6 +56,7 @@ public:
     virtual ~MutationRecord();
 
     virtual const AtomicString& type() = 0;
+    bool isChildList();
     virtual Node* target() = 0;
 
     virtual NodeList* addedNodes() = 0;
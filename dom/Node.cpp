@@ -711,18 +711,14 @@ bool Document::shouldInvalidateNodeListAndCollectionCaches(const QualifiedName*
 
 void Document::invalidateNodeListAndCollectionCaches(const QualifiedName* attrName)
 {
-#if !ASSERT_DISABLED
-    m_inInvalidateNodeListAndCollectionCaches = true;
-#endif
-    HashSet<LiveNodeList*> lists = WTF::move(m_listsInvalidatedAtDocument);
-    for (auto* list : lists)
-        list->invalidateCacheForAttribute(attrName);
-    HashSet<HTMLCollection*> collections = WTF::move(m_collectionsInvalidatedAtDocument);
-    for (auto* collection : collections)
-        collection->invalidateCache(attrName);
-#if !ASSERT_DISABLED
-    m_inInvalidateNodeListAndCollectionCaches = false;
-#endif
+    for (int type = 0; type < numNodeListInvalidationTypes; type++) {
+        if (attrName && !shouldInvalidateTypeOnAttributeChange(static_cast<NodeListInvalidationType>(type), *attrName))
+            continue;
+        ASSERT(m_nodeListAndCollectionCounts[type] >= m_documentRootedNodeListAndCollectionCounts[type]);
+        m_nodeListAndCollectionCounts[type] -= m_documentRootedNodeListAndCollectionCounts[type];
+        m_documentRootedNodeListAndCollectionCounts[type] = 0;
+        m_nodeListAndCollectionInvalidationVersions[type]++;
+    }
 }
 
 void Node::invalidateNodeListAndCollectionCachesInAncestors(const QualifiedName* attrName, Element* attributeOwnerElement)
@@ -1674,14 +1670,21 @@ void Node::showTreeForThisAcrossFrame() const
 
 void NodeListsNodeData::invalidateCaches(const QualifiedName* attrName)
 {
-    for (auto& atomicName : m_atomicNameCaches)
-        atomicName.value->invalidateCacheForAttribute(attrName);
+    // Caches rooted at the document check Document's invalidation versions on access instead.
+    for (auto& atomicName : m_atomicNameCaches) {
+        if (!atomicName.value->isRootedAtDocument())
+            atomicName.value->invalidateCacheForAttribute(attrName);
+    }
 
-    for (auto& name : m_nameCaches)
-        name.value->invalidateCacheForAttribute(attrName);
+    for (auto& name : m_nameCaches) {
+        if (!name.value->isRootedAtDocument())
+            name.value->invalidateCacheForAttribute(attrName);
+    }
 
-    for (auto& collection : m_cachedCollections)
-        collection.value->invalidateCache(attrName);
+    for (auto& collection : m_cachedCollections) {
+        if (!collection.value->isRootedAtDocument())
+            collection.value->invalidateCache(attrName);
+    }
 
     if (attrName)
         return;
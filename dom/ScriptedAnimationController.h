@@ -64,6 +64,7 @@ public:
     CallbackId registerCallback(PassRefPtr<RequestAnimationFrameCallback>);
     void cancelCallback(CallbackId);
     void serviceScriptedAnimations(double monotonicTimeNow);
+    bool hasPendingCallbacks() const { return !m_suspendCount && !m_callbacks.isEmpty(); }
 
     void suspend();
     void resume();
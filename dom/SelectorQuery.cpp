@@ -35,6 +35,8 @@
 
 namespace WebCore {
 
+static unsigned indexedQueries;
+
 #if !ASSERT_DISABLED
 static bool isSingleTagNameSelector(const CSSSelector& selector)
 {
@@ -68,7 +70,19 @@ static IdMatchingType findIdMatchingType(const CSSSelector& firstSelector)
     return IdMatchingType::None;
 }
 
+static const CSSSelector* rightmostClassSelector(const CSSSelector& firstSelector)
+{
+    for (const CSSSelector* selector = &firstSelector; selector; selector = selector->tagHistory()) {
+        if (selector->m_match == CSSSelector::Class)
+            return selector;
+        if (selector->relation() != CSSSelector::SubSelector)
+            break;
+    }
+    return nullptr;
+}
+
 SelectorDataList::SelectorDataList(const CSSSelectorList& selectorList)
+    : m_candidateIndex(CandidateIndex::None)
 {
     unsigned selectorCount = 0;
     for (const CSSSelector* selector = selectorList.first(); selector; selector = CSSSelectorList::next(selector))
@@ -110,6 +124,19 @@ SelectorDataList::SelectorDataList(const CSSSelectorList& selectorList)
         }
     } else
         m_matchType = MultipleSelectorMatch;
+
+    if (m_matchType == MultipleSelectorMatch || m_matchType == RightMostWithIdMatch)
+        return;
+    const CSSSelector& selector = *m_selectors.first().selector;
+    if (m_matchType == TagNameMatch) {
+        if (selector.tagQName().namespaceURI() == starAtom && selector.tagQName().localName() != starAtom) {
+            m_candidateIndex = CandidateIndex::LocalName;
+            m_candidateIndexKey = selector.tagQName().localName();
+        }
+    } else if (const CSSSelector* classSelector = rightmostClassSelector(selector)) {
+        m_candidateIndex = CandidateIndex::ClassName;
+        m_candidateIndexKey = classSelector->value();
+    }
 }
 
 inline bool SelectorDataList::selectorMatches(const SelectorData& selectorData, Element& element, const ContainerNode& rootNode) const
@@ -359,6 +386,40 @@ ALWAYS_INLINE void SelectorDataList::executeSingleMultiSelectorData(const Contai
     }
 }
 
+const Vector<Element*>* SelectorDataList::indexedCandidates(ContainerNode& rootNode) const
+{
+    if (m_candidateIndex == CandidateIndex::None)
+        return nullptr;
+    // The indexes cover whole connected tree scopes. Walking a subtree is cheaper than filtering
+    // the candidates of the whole scope, and class names are case folded in quirks mode.
+    if (!rootNode.inDocument() || !isTreeScopeRoot(rootNode))
+        return nullptr;
+    if (rootNode.document().inQuirksMode())
+        return nullptr;
+
+    if (m_candidateIndex == CandidateIndex::ClassName)
+        return &rootNode.treeScope().elementsWithClassName(m_candidateIndexKey);
+    ASSERT(m_candidateIndex == CandidateIndex::LocalName);
+    return &rootNode.treeScope().elementsWithLocalName(m_candidateIndexKey);
+}
+
+template <typename SelectorQueryTrait>
+ALWAYS_INLINE void SelectorDataList::executeWithIndexedCandidates(ContainerNode& rootNode, const Vector<Element*>& candidates, typename SelectorQueryTrait::OutputType& output) const
+{
+    ASSERT(m_selectors.size() == 1);
+    ASSERT(isTreeScopeRoot(rootNode));
+
+    // Candidates of a lone tag or class selector match by construction.
+    bool candidatesMatch = m_matchType == TagNameMatch || m_matchType == ClassNameMatch;
+    for (Element* element : candidates) {
+        if (candidatesMatch || selectorMatches(m_selectors.first(), *element, rootNode)) {
+            SelectorQueryTrait::appendOutputForElement(output, element);
+            if (SelectorQueryTrait::shouldOnlyMatchFirstElement)
+                return;
+        }
+    }
+}
+
 #if ENABLE(CSS_SELECTOR_JIT)
 template <typename SelectorQueryTrait>
 ALWAYS_INLINE void SelectorDataList::executeCompiledSimpleSelectorChecker(const ContainerNode& rootNode, SelectorCompiler::SimpleSelectorChecker selectorChecker, typename SelectorQueryTrait::OutputType& output, const SelectorData& selectorData) const
@@ -381,6 +442,15 @@ ALWAYS_INLINE void SelectorDataList::executeCompiledSimpleSelectorChecker(const
 template <typename SelectorQueryTrait>
 ALWAYS_INLINE void SelectorDataList::execute(ContainerNode& rootNode, typename SelectorQueryTrait::OutputType& output) const
 {
+    // Building an index walks the whole scope, which querySelector() can usually avoid.
+    if (!SelectorQueryTrait::shouldOnlyMatchFirstElement) {
+        if (const Vector<Element*>* candidates = indexedCandidates(rootNode)) {
+            ++indexedQueries;
+            executeWithIndexedCandidates<SelectorQueryTrait>(rootNode, *candidates, output);
+            return;
+        }
+    }
+
     ContainerNode* searchRootNode = &rootNode;
     switch (m_matchType) {
     case RightMostWithIdMatch:
@@ -464,6 +534,11 @@ ALWAYS_INLINE void SelectorDataList::execute(ContainerNode& rootNode, typename S
     }
 }
 
+unsigned SelectorQuery::indexedQueryCount()
+{
+    return indexedQueries;
+}
+
 SelectorQuery::SelectorQuery(CSSSelectorList&& selectorList)
     : m_selectorList(selectorList)
     , m_selectors(m_selectorList)
@@ -88,6 +88,8 @@ private:
     template <typename SelectorQueryTrait> void executeSingleClassNameSelectorData(const ContainerNode& rootNode, const SelectorData&, typename SelectorQueryTrait::OutputType&) const;
     template <typename SelectorQueryTrait> void executeSingleSelectorData(const ContainerNode& rootNode, const SelectorData&, typename SelectorQueryTrait::OutputType&) const;
     template <typename SelectorQueryTrait> void executeSingleMultiSelectorData(const ContainerNode& rootNode, typename SelectorQueryTrait::OutputType&) const;
+    template <typename SelectorQueryTrait> void executeWithIndexedCandidates(ContainerNode& rootNode, const Vector<Element*>& candidates, typename SelectorQueryTrait::OutputType&) const;
+    const Vector<Element*>* indexedCandidates(ContainerNode& rootNode) const;
 #if ENABLE(CSS_SELECTOR_JIT)
     template <typename SelectorQueryTrait> void executeCompiledSimpleSelectorChecker(const ContainerNode& rootNode, SelectorCompiler::SimpleSelectorChecker, typename SelectorQueryTrait::OutputType&, const SelectorData&) const;
 #endif // ENABLE(CSS_SELECTOR_JIT)
@@ -104,6 +106,14 @@ private:
         ClassNameMatch,
         MultipleSelectorMatch,
     } m_matchType;
+
+    // Every match of the selector is among the TreeScope's elements with this class or local name.
+    enum class CandidateIndex {
+        None,
+        ClassName,
+        LocalName,
+    } m_candidateIndex;
+    AtomicString m_candidateIndexKey;
 };
 
 class SelectorQuery {
@@ -116,6 +126,9 @@ public:
     RefPtr<NodeList> queryAll(ContainerNode& rootNode) const;
     Element* queryFirst(ContainerNode& rootNode) const;
 
+    // Number of queries answered from the candidates of a TreeScope class or tag index.
+    static unsigned indexedQueryCount();
+
 private:
     CSSSelectorList m_selectorList;
     SelectorDataList m_selectors;
@@ -29,6 +29,7 @@
 
 #include "DOMSelection.h"
 #include "DOMWindow.h"
+#include "ElementDescendantIterator.h"
 #include "ElementIterator.h"
 #include "FocusController.h"
 #include "Frame.h"
@@ -44,18 +45,32 @@
 #include "RuntimeEnabledFeatures.h"
 #include "ShadowRoot.h"
 #include "TreeScopeAdopter.h"
+#include <wtf/text/AtomicStringHash.h>
 #include <wtf/text/CString.h>
 
 namespace WebCore {
 
 struct SameSizeAsTreeScope {
-    void* pointers[9];
+    void* pointers[10];
 };
 
 COMPILE_ASSERT(sizeof(TreeScope) == sizeof(SameSizeAsTreeScope), treescope_should_stay_small);
 
 using namespace HTMLNames;
 
+static unsigned elementIndexListBuilds;
+
+struct TreeScope::ElementIndex {
+    explicit ElementIndex(uint64_t domTreeVersion)
+        : domTreeVersion(domTreeVersion)
+    {
+    }
+
+    uint64_t domTreeVersion;
+    HashMap<AtomicString, Vector<Element*>> elementsByClassName;
+    HashMap<AtomicString, Vector<Element*>> elementsByLocalName;
+};
+
 TreeScope::TreeScope(ShadowRoot& shadowRoot, Document& document)
     : m_rootNode(shadowRoot)
     , m_documentScope(&document)
@@ -87,6 +102,7 @@ void TreeScope::destroyTreeScopeData()
     m_elementsById = nullptr;
     m_imageMapsByName = nullptr;
     m_labelsByForAttribute = nullptr;
+    m_elementIndex = nullptr;
 }
 
 void TreeScope::setParentTreeScope(TreeScope* newParentScope)
@@ -100,6 +116,49 @@ void TreeScope::setParentTreeScope(TreeScope* newParentScope)
     setDocumentScope(&newParentScope->documentScope());
 }
 
+TreeScope::ElementIndex& TreeScope::elementIndex()
+{
+    // Any tree mutation or attribute change bumps the DOM tree version, so the
+    // raw pointers in a current index always point to elements of this scope.
+    uint64_t domTreeVersion = documentScope().domTreeVersion();
+    if (!m_elementIndex || m_elementIndex->domTreeVersion != domTreeVersion)
+        m_elementIndex = std::make_unique<ElementIndex>(domTreeVersion);
+    return *m_elementIndex;
+}
+
+const Vector<Element*>& TreeScope::elementsWithClassName(const AtomicString& className)
+{
+    auto addResult = elementIndex().elementsByClassName.add(className, Vector<Element*>());
+    if (addResult.isNewEntry) {
+        ++elementIndexListBuilds;
+        Vector<Element*>& elements = addResult.iterator->value;
+        for (auto& element : elementDescendants(m_rootNode)) {
+            if (element.hasClass() && element.classNames().contains(className))
+                elements.append(&element);
+        }
+    }
+    return addResult.iterator->value;
+}
+
+const Vector<Element*>& TreeScope::elementsWithLocalName(const AtomicString& localName)
+{
+    auto addResult = elementIndex().elementsByLocalName.add(localName, Vector<Element*>());
+    if (addResult.isNewEntry) {
+        ++elementIndexListBuilds;
+        Vector<Element*>& elements = addResult.iterator->value;
+        for (auto& element : elementDescendants(m_rootNode)) {
+            if (element.tagQName().localName() == localName)
+                elements.append(&element);
+        }
+    }
+    return addResult.iterator->value;
+}
+
+unsigned TreeScope::elementIndexListBuildCount()
+{
+    return elementIndexListBuilds;
+}
+
 Element* TreeScope::getElementById(const AtomicString& elementId) const
 {
     if (elementId.isNull())
@@ -101,6 +101,13 @@ public:
 
     IdTargetObserverRegistry& idTargetObserverRegistry() const { return *m_idTargetObserverRegistry.get(); }
 
+    // Used by selector queries. The elements of this scope in tree order. The lists are built on
+    // demand and thrown away as soon as the document's DOM tree version changes.
+    const Vector<Element*>& elementsWithClassName(const AtomicString&);
+    const Vector<Element*>& elementsWithLocalName(const AtomicString&);
+    // Number of class or tag lists built, in any scope, since the process started.
+    static unsigned elementIndexListBuildCount();
+
 protected:
     TreeScope(ShadowRoot&, Document&);
     explicit TreeScope(Document&);
@@ -114,6 +121,9 @@ protected:
     }
 
 private:
+    struct ElementIndex;
+    ElementIndex& elementIndex();
+
     ContainerNode& m_rootNode;
     Document* m_documentScope;
     TreeScope* m_parentTreeScope;
@@ -125,6 +135,8 @@ private:
 
     std::unique_ptr<IdTargetObserverRegistry> m_idTargetObserverRegistry;
 
+    std::unique_ptr<ElementIndex> m_elementIndex;
+
     mutable RefPtr<DOMSelection> m_selection;
 };
 
@@ -134,6 +134,8 @@ static NodeListInvalidationType invalidationTypeExcludingIdAndNameAttributes(Col
 HTMLCollection::HTMLCollection(ContainerNode& ownerNode, CollectionType type, ElementTraversalType traversalType)
     : m_ownerNode(ownerNode)
     , m_indexCache(*this)
+    , m_indexCacheVersion(0)
+    , m_namedElementCacheVersion(0)
     , m_collectionType(type)
     , m_invalidationType(invalidationTypeExcludingIdAndNameAttributes(type))
     , m_rootType(rootTypeFromCollectionType(type))
@@ -258,11 +260,13 @@ inline Element* nextMatchingElement(const HTMLCollection& collection, Element* c
 
 unsigned HTMLCollection::length() const
 {
+    invalidateCacheIfStale();
     return m_indexCache.nodeCount(*this);
 }
 
 Node* HTMLCollection::item(unsigned offset) const
 {
+    invalidateCacheIfStale();
     return m_indexCache.nodeAt(*this, offset);
 }
 
@@ -372,6 +376,18 @@ void HTMLCollection::invalidateCache(Document& document) const
         invalidateNamedElementCache(document);
 }
 
+void HTMLCollection::invalidateCacheIfStale() const
+{
+    // Collections rooted at the document are not invalidated on mutation; see Document::invalidateNodeListAndCollectionCaches().
+    if (!isRootedAtDocument())
+        return;
+    Document& document = this->document();
+    if (m_indexCache.hasValidCache(*this) && m_indexCacheVersion != document.nodeListAndCollectionInvalidationVersion(invalidationType()))
+        invalidateCache(document);
+    else if (hasNamedElementCache() && m_namedElementCacheVersion != document.nodeListAndCollectionInvalidationVersion(InvalidateOnIdNameAttrChange))
+        invalidateNamedElementCache(document);
+}
+
 void HTMLCollection::invalidateNamedElementCache(Document& document) const
 {
     ASSERT(hasNamedElementCache());
@@ -430,6 +446,7 @@ Node* HTMLCollection::namedItem(const AtomicString& name) const
 
 void HTMLCollection::updateNamedElementCache() const
 {
+    invalidateCacheIfStale();
     if (hasNamedElementCache())
         return;
 
@@ -129,6 +129,12 @@ public:
 
     bool hasNamedElementCache() const { return !!m_namedElementCache; }
 
+    // Only meaningful for collections rooted at the document; see Document::registerCollection().
+    uint64_t indexCacheVersion() const { return m_indexCacheVersion; }
+    void setIndexCacheVersion(uint64_t version) { m_indexCacheVersion = version; }
+    uint64_t namedElementCacheVersion() const { return m_namedElementCacheVersion; }
+    void setNamedElementCacheVersion(uint64_t version) const { m_namedElementCacheVersion = version; }
+
 protected:
     enum ElementTraversalType { NormalTraversal, CustomForwardOnlyTraversal };
     HTMLCollection(ContainerNode& base, CollectionType, ElementTraversalType = NormalTraversal);
@@ -162,11 +168,14 @@ private:
     virtual Element* customElementAfter(Element*) const { ASSERT_NOT_REACHED(); return nullptr; }
     
     void invalidateNamedElementCache(Document&) const;
+    void invalidateCacheIfStale() const;
 
     Ref<ContainerNode> m_ownerNode;
 
     mutable CollectionIndexCache<HTMLCollection, Element*> m_indexCache;
     mutable std::unique_ptr<CollectionNamedElementCache> m_namedElementCache;
+    uint64_t m_indexCacheVersion;
+    mutable uint64_t m_namedElementCacheVersion;
 
     const unsigned m_collectionType : 5;
     const unsigned m_invalidationType : 4;
@@ -36,6 +36,7 @@ namespace WebCore {
 CSSPreloadScanner::CSSPreloadScanner()
     : m_state(Initial)
     , m_requests(nullptr)
+    , m_predictedBaseElementURL(nullptr)
 {
 }
 
@@ -48,12 +49,14 @@ void CSSPreloadScanner::reset()
     m_state = Initial;
     m_rule.clear();
     m_ruleValue.clear();
+    m_mediaList.clear();
 }
 
-void CSSPreloadScanner::scan(const HTMLToken::DataVector& data, PreloadRequestStream& requests)
+void CSSPreloadScanner::scan(const HTMLToken::DataVector& data, const URL& predictedBaseElementURL, PreloadRequestStream& requests)
 {
     ASSERT(!m_requests);
     TemporaryChange<PreloadRequestStream*> change(m_requests, &requests);
+    TemporaryChange<const URL*> baseURLChange(m_predictedBaseElementURL, &predictedBaseElementURL);
 
     for (UChar c : data) {
         if (m_state == DoneParsingImportRules)
@@ -100,6 +103,7 @@ inline void CSSPreloadScanner::tokenize(UChar c)
         if ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z')) {
             m_rule.clear();
             m_ruleValue.clear();
+            m_mediaList.clear();
             m_rule.append(c);
             m_state = Rule;
         } else
@@ -141,10 +145,18 @@ inline void CSSPreloadScanner::tokenize(UChar c)
         else if (c == '{')
             m_state = DoneParsingImportRules;
         else {
-            // FIXME: media rules
-            m_state = Initial;
+            m_state = MediaList;
+            m_mediaList.append(c);
         }
         break;
+    case MediaList:
+        if (c == ';')
+            emitRule();
+        else if (c == '{')
+            m_state = DoneParsingImportRules;
+        else
+            m_mediaList.append(c);
+        break;
     case DoneParsingImportRules:
         ASSERT_NOT_REACHED();
         break;
@@ -207,10 +219,11 @@ void CSSPreloadScanner::emitRule()
     if (ruleEqualIgnoringCase(m_rule, "import")) {
         String url = parseCSSStringOrURL(m_ruleValue.data(), m_ruleValue.size());
         if (!url.isEmpty()) {
-            URL baseElementURL; // FIXME: This should be passed in from the HTMLPreloadScaner via scan()!
+            // The media list is checked by HTMLResourcePreloader the same way as a <link> media attribute.
+            String mediaList = stripLeadingAndTrailingHTMLSpaces(String(m_mediaList.data(), m_mediaList.size()));
 
             // FIXME: Should this be including the charset in the preload request?
-            m_requests->append(std::make_unique<PreloadRequest>("css", url, baseElementURL, CachedResource::CSSStyleSheet, String()));
+            m_requests->append(std::make_unique<PreloadRequest>("css", url, *m_predictedBaseElementURL, CachedResource::CSSStyleSheet, mediaList));
         }
         m_state = Initial;
     } else if (ruleEqualIgnoringCase(m_rule, "charset"))
@@ -219,6 +232,7 @@ void CSSPreloadScanner::emitRule()
         m_state = DoneParsingImportRules;
     m_rule.clear();
     m_ruleValue.clear();
+    m_mediaList.clear();
 }
 
 }
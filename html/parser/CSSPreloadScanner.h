@@ -41,7 +41,7 @@ public:
 
     void reset();
 
-    void scan(const HTMLToken::DataVector&, PreloadRequestStream&);
+    void scan(const HTMLToken::DataVector&, const URL& predictedBaseElementURL, PreloadRequestStream&);
 
 private:
     enum State {
@@ -54,6 +54,7 @@ private:
         AfterRule,
         RuleValue,
         AfterRuleValue,
+        MediaList,
         DoneParsingImportRules,
     };
 
@@ -63,9 +64,11 @@ private:
     State m_state;
     Vector<UChar> m_rule;
     Vector<UChar> m_ruleValue;
+    Vector<UChar> m_mediaList;
 
     // Only non-zero during scan()
     PreloadRequestStream* m_requests;
+    const URL* m_predictedBaseElementURL;
 };
 
 }
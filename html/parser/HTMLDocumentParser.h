@@ -45,8 +45,6 @@
 
 namespace WebCore {
 
-class BackgroundHTMLParser;
-class CompactHTMLToken;
 class Document;
 class DocumentFragment;
 class HTMLDocument;
@@ -162,7 +160,6 @@ private:
     std::unique_ptr<HTMLResourcePreloader> m_preloader;
 
     bool m_endWasDelayed;
-    bool m_haveBackgroundParser;
     unsigned m_pumpSessionNestingLevel;
 };
 
@@ -111,6 +111,12 @@ void HTMLEntitySearch::advance(UChar nextCharacter)
         m_last = HTMLEntityTable::lastEntryStartingWith(nextCharacter);
         if (!m_first || !m_last)
             return fail();
+    } else if (m_currentLength == 1) {
+        UChar firstCharacter = m_first->entity[0];
+        m_first = HTMLEntityTable::firstEntryStartingWith(firstCharacter, nextCharacter);
+        m_last = HTMLEntityTable::lastEntryStartingWith(firstCharacter, nextCharacter);
+        if (!m_first || !m_last)
+            return fail();
     } else {
         m_first = findFirst(nextCharacter);
         m_last = findLast(nextCharacter);
@@ -46,6 +46,9 @@ public:
 
     static const HTMLEntityTableEntry* firstEntryStartingWith(UChar);
     static const HTMLEntityTableEntry* lastEntryStartingWith(UChar);
+
+    static const HTMLEntityTableEntry* firstEntryStartingWith(UChar first, UChar second);
+    static const HTMLEntityTableEntry* lastEntryStartingWith(UChar first, UChar second);
 };
 
 }
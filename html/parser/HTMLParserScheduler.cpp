@@ -30,18 +30,29 @@
 #include "Document.h"
 #include "FrameView.h"
 #include "HTMLDocumentParser.h"
+#include "Logging.h"
 #include "Page.h"
 
 // defaultParserChunkSize is used to define how many tokens the parser will
 // process before checking against parserTimeLimit and possibly yielding.
 // This is a performance optimization to prevent checking after every token.
+// Once the cost of a token has been measured, the chunk size is adapted so
+// that checks land roughly every maximumTimeBetweenYieldChecks seconds, but
+// it never exceeds this value.
 static const int defaultParserChunkSize = 4096;
+static const int minimumParserChunkSize = 64;
+static const double maximumTimeBetweenYieldChecks = 0.004;
 
 // defaultParserTimeLimit is the seconds the parser will run in one write() call
-// before yielding. Inline <script> execution can cause it to exceed the limit.
-// FIXME: We would like this value to be 0.2.
+// before yielding when the page has nothing else to do. Inline <script>
+// execution can cause it to exceed the limit.
 static const double defaultParserTimeLimit = 0.500;
 
+// When a frame is waiting to be produced, the parser yields after this many
+// seconds instead, leaving the rest of a 60fps frame for style, layout,
+// requestAnimationFrame callbacks and painting.
+static const double parserFrameTimeLimit = 0.010;
+
 namespace WebCore {
 
 static double parserTimeLimit(Page* page)
@@ -77,6 +88,10 @@ PumpSession::PumpSession(unsigned& nestingLevel, Document* document)
     , startTime(0)
     , needsYield(false)
     , didSeeScript(false)
+    , beginTime(0)
+    , totalProcessedTokens(0)
+    , lastCheckTime(0)
+    , yieldReason(PumpYieldReason::DidNotYield)
 {
 }
 
@@ -88,6 +103,7 @@ HTMLParserScheduler::HTMLParserScheduler(HTMLDocumentParser& parser)
     : m_parser(parser)
     , m_parserTimeLimit(parserTimeLimit(m_parser.document()->page()))
     , m_parserChunkSize(defaultParserChunkSize)
+    , m_estimatedTimePerToken(0)
     , m_continueNextChunkTimer(this, &HTMLParserScheduler::continueNextChunkTimerFired)
     , m_isSuspendedWithActiveTimer(false)
 #if !ASSERT_DISABLED
@@ -115,17 +131,122 @@ void HTMLParserScheduler::continueNextChunkTimerFired(Timer<HTMLParserScheduler>
     m_parser.resumeParsingAfterYield();
 }
 
+bool HTMLParserScheduler::shouldYieldAtFrameDeadline() const
+{
+    Document* document = m_parser.document();
+#if ENABLE(REQUEST_ANIMATION_FRAME)
+    if (document->hasPendingAnimationFrameCallbacks())
+        return true;
+#endif
+    // Layouts are scheduled all the time while parsing; only hurry the first paint.
+    bool needsFirstPaint = document->view() && !document->view()->hasEverPainted();
+    return needsFirstPaint && document->isLayoutTimerActive();
+}
+
+void HTMLParserScheduler::checkForYieldAfterChunk(PumpSession& session)
+{
+    // monotonicallyIncreasingTime() can be expensive. By delaying, we avoided calling
+    // monotonicallyIncreasingTime() when constructing non-yielding PumpSessions.
+    double currentTime = monotonicallyIncreasingTime();
+    if (!session.startTime)
+        session.startTime = currentTime;
+    else if (!session.didSeeScript && session.processedTokens > 0) {
+        // Time spent running scripts would skew the estimate.
+        double timePerToken = (currentTime - session.lastCheckTime) / session.processedTokens;
+        m_estimatedTimePerToken = m_estimatedTimePerToken ? (3 * m_estimatedTimePerToken + timePerToken) / 4 : timePerToken;
+    }
+
+    session.lastCheckTime = currentTime;
+    session.processedTokens = 0;
+    session.didSeeScript = false;
+
+    bool frameIsPending = shouldYieldAtFrameDeadline();
+    double timeLimit = frameIsPending ? std::min(m_parserTimeLimit, parserFrameTimeLimit) : m_parserTimeLimit;
+    double elapsedTime = currentTime - session.startTime;
+    if (elapsedTime > timeLimit) {
+        session.needsYield = true;
+        session.yieldReason = frameIsPending ? PumpYieldReason::FrameDeadline : PumpYieldReason::TimeLimit;
+        return;
+    }
+
+    // Check again when the time limit runs out, or sooner so that we notice when
+    // a frame starts waiting for us.
+    if (!m_estimatedTimePerToken) {
+        m_parserChunkSize = defaultParserChunkSize;
+        return;
+    }
+    double timeUntilNextCheck = std::min(timeLimit - elapsedTime, maximumTimeBetweenYieldChecks);
+    double tokensUntilNextCheck = timeUntilNextCheck / m_estimatedTimePerToken;
+    m_parserChunkSize = static_cast<int>(std::max<double>(minimumParserChunkSize, std::min<double>(defaultParserChunkSize, tokensUntilNextCheck)));
+}
+
 void HTMLParserScheduler::checkForYieldBeforeScript(PumpSession& session)
 {
     // If we've never painted before and a layout is pending, yield prior to running
     // scripts to give the page a chance to paint earlier.
     Document* document = m_parser.document();
     bool needsFirstPaint = document->view() && !document->view()->hasEverPainted();
-    if (needsFirstPaint && document->isLayoutTimerActive())
+    if (needsFirstPaint && document->isLayoutTimerActive()) {
         session.needsYield = true;
+        session.yieldReason = PumpYieldReason::FirstPaintBeforeScript;
+    }
     session.didSeeScript = true;
 }
 
+static unsigned pumpSessions;
+static unsigned pumpedTokens;
+static unsigned yieldsByReason[numberOfPumpYieldReasons];
+
+const char* HTMLParserScheduler::yieldReasonName(PumpYieldReason reason)
+{
+    switch (reason) {
+    case PumpYieldReason::DidNotYield:
+        return "did not yield";
+    case PumpYieldReason::TimeLimit:
+        return "time limit";
+    case PumpYieldReason::FrameDeadline:
+        return "frame deadline";
+    case PumpYieldReason::FirstPaintBeforeScript:
+        return "first paint before script";
+    case PumpYieldReason::WebThreadShouldYield:
+        return "web thread should yield";
+    }
+    ASSERT_NOT_REACHED();
+    return "";
+}
+
+void HTMLParserScheduler::didBeginPumpSession(PumpSession& session)
+{
+    // Pumps that may yield check the time before their first token anyway.
+    session.beginTime = monotonicallyIncreasingTime();
+}
+
+void HTMLParserScheduler::didEndPumpSession(const PumpSession& session)
+{
+    ++pumpSessions;
+    pumpedTokens += session.totalProcessedTokens;
+    ++yieldsByReason[static_cast<unsigned>(session.yieldReason)];
+#if !LOG_DISABLED
+    double elapsedTime = session.beginTime ? monotonicallyIncreasingTime() - session.beginTime : 0;
+    LOG(Loading, "HTMLParserScheduler %p pumped %u tokens in %.2fms (%s), next chunk is %d tokens", this, session.totalProcessedTokens, elapsedTime * 1000, yieldReasonName(session.yieldReason), m_parserChunkSize);
+#endif
+}
+
+unsigned HTMLParserScheduler::pumpSessionCount()
+{
+    return pumpSessions;
+}
+
+unsigned HTMLParserScheduler::pumpedTokenCount()
+{
+    return pumpedTokens;
+}
+
+unsigned HTMLParserScheduler::yieldCount(PumpYieldReason reason)
+{
+    return yieldsByReason[static_cast<unsigned>(reason)];
+}
+
 void HTMLParserScheduler::scheduleForResume()
 {
     ASSERT(!m_suspended);
@@ -49,6 +49,15 @@ private:
     RefPtr<Document> m_document;
 };
 
+enum class PumpYieldReason {
+    DidNotYield,
+    TimeLimit,
+    FrameDeadline,
+    FirstPaintBeforeScript,
+    WebThreadShouldYield,
+};
+const unsigned numberOfPumpYieldReasons = static_cast<unsigned>(PumpYieldReason::WebThreadShouldYield) + 1;
+
 class PumpSession : public NestingLevelIncrementer, public ActiveParserSession {
 public:
     PumpSession(unsigned& nestingLevel, Document*);
@@ -58,6 +67,12 @@ public:
     double startTime;
     bool needsYield;
     bool didSeeScript;
+
+    // Only tracked for pumps that are allowed to yield.
+    double beginTime;
+    unsigned totalProcessedTokens;
+    double lastCheckTime;
+    PumpYieldReason yieldReason;
 };
 
 class HTMLParserScheduler {
@@ -70,25 +85,25 @@ public:
     void checkForYieldBeforeToken(PumpSession& session)
     {
 #if PLATFORM(IOS)
-        if (WebThreadShouldYield())
+        if (WebThreadShouldYield()) {
             session.needsYield = true;
-#endif
-        if (session.processedTokens > m_parserChunkSize || session.didSeeScript) {
-            // monotonicallyIncreasingTime() can be expensive. By delaying, we avoided calling
-            // monotonicallyIncreasingTime() when constructing non-yielding PumpSessions.
-            if (!session.startTime)
-                session.startTime = monotonicallyIncreasingTime();
-
-            session.processedTokens = 0;
-            session.didSeeScript = false;
-
-            double elapsedTime = monotonicallyIncreasingTime() - session.startTime;
-            if (elapsedTime > m_parserTimeLimit)
-                session.needsYield = true;
+            session.yieldReason = PumpYieldReason::WebThreadShouldYield;
         }
+#endif
+        if (session.processedTokens > m_parserChunkSize || session.didSeeScript)
+            checkForYieldAfterChunk(session);
         ++session.processedTokens;
+        ++session.totalProcessedTokens;
     }
     void checkForYieldBeforeScript(PumpSession&);
+    void didBeginPumpSession(PumpSession&);
+    void didEndPumpSession(const PumpSession&);
+
+    // Statistics on the pumps that were allowed to yield, across all parsers.
+    static unsigned pumpSessionCount();
+    static unsigned pumpedTokenCount();
+    static unsigned yieldCount(PumpYieldReason);
+    static const char* yieldReasonName(PumpYieldReason);
 
     void scheduleForResume();
     bool isScheduledForResume() const { return m_isSuspendedWithActiveTimer || m_continueNextChunkTimer.isActive(); }
@@ -97,12 +112,15 @@ public:
     void resume();
 
 private:
+    void checkForYieldAfterChunk(PumpSession&);
+    bool shouldYieldAtFrameDeadline() const;
     void continueNextChunkTimerFired(Timer<HTMLParserScheduler>&);
 
     HTMLDocumentParser& m_parser;
 
     double m_parserTimeLimit;
     int m_parserChunkSize;
+    double m_estimatedTimePerToken;
     Timer<HTMLParserScheduler> m_continueNextChunkTimer;
     bool m_isSuspendedWithActiveTimer;
 #if !ASSERT_DISABLED
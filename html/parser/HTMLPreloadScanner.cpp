@@ -34,6 +34,7 @@
 #include "HTMLTokenizer.h"
 #include "InputTypeNames.h"
 #include "LinkRelAttribute.h"
+#include "Logging.h"
 #include "SourceSizeList.h"
 #include <wtf/MainThread.h>
 
@@ -289,7 +290,7 @@ void TokenPreloadScanner::scan(const HTMLToken& token, Vector<std::unique_ptr<Pr
     case HTMLToken::Character:
         if (!m_inStyle)
             return;
-        m_cssScanner.scan(token.data(), requests);
+        m_cssScanner.scan(token.data(), m_predictedBaseElementURL, requests);
         return;
 
     case HTMLToken::EndTag: {
@@ -385,6 +386,9 @@ void HTMLPreloadScanner::scan(HTMLResourcePreloader* preloader, const URL& start
         m_scanner.setPredictedBaseElementURL(startingBaseElementURL);
 
     PreloadRequestStream requests;
+#if !LOG_DISABLED
+    int startPosition = m_source.numberOfCharactersConsumed();
+#endif
 
     while (m_tokenizer->nextToken(m_source, m_token)) {
         if (m_token.type() == HTMLToken::StartTag)
@@ -397,6 +401,8 @@ void HTMLPreloadScanner::scan(HTMLResourcePreloader* preloader, const URL& start
         m_token.clear();
     }
 
+    LOG(Loading, "HTMLPreloadScanner %p scanned %d characters ahead of the parser and found %zu resources to preload", this, m_source.numberOfCharactersConsumed() - startPosition, requests.size());
+
     preloader->preload(WTF::move(requests));
 }
 
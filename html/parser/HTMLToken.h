@@ -336,6 +336,20 @@ public:
         m_currentAttribute->value.append(character);
     }
 
+    void appendToAttributeValue(const LChar* characters, unsigned length)
+    {
+        ASSERT(m_type == StartTag || m_type == EndTag);
+        ASSERT(m_currentAttribute->valueRange.start);
+        m_currentAttribute->value.append(characters, length);
+    }
+
+    void appendToAttributeValue(const UChar* characters, unsigned length)
+    {
+        ASSERT(m_type == StartTag || m_type == EndTag);
+        ASSERT(m_currentAttribute->valueRange.start);
+        m_currentAttribute->value.append(characters, length);
+    }
+
     void appendToAttributeValue(size_t i, StringView value)
     {
         ASSERT(!value.isEmpty());
@@ -394,6 +408,20 @@ public:
         m_orAllData |= character;
     }
 
+    void appendToCharacter(const LChar* characters, unsigned length)
+    {
+        ASSERT(m_type == Character);
+        m_data.append(characters, length);
+    }
+
+    void appendToCharacter(const UChar* characters, unsigned length)
+    {
+        ASSERT(m_type == Character);
+        m_data.append(characters, length);
+        for (unsigned i = 0; i < length; ++i)
+            m_orAllData |= characters[i];
+    }
+
     void appendToCharacter(const Vector<LChar, 32>& characters)
     {
         ASSERT(m_type == Character);
@@ -36,6 +36,10 @@
 #include <wtf/CurrentTime.h>
 #include <wtf/text/CString.h>
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 using namespace WTF;
 
 namespace WebCore {
@@ -161,6 +165,111 @@ bool HTMLTokenizer::flushBufferedEndTag(SegmentedString& source)
         goto stateName;                                                    \
     } while (false)
 
+// The data state and the quoted attribute value states only need to look at
+// characters that end the run, start a character reference, or get rewritten
+// (or counted) by the InputStreamPreprocessor.
+static inline bool isOrdinaryCharacter(UChar character, UChar delimiter)
+{
+    return character != delimiter && character != '&' && character != '\n' && character != '\r' && character;
+}
+
+template<typename CharacterType>
+static inline unsigned ordinaryCharacterRunLength(const CharacterType* characters, unsigned length, UChar delimiter, unsigned start = 0)
+{
+    for (unsigned i = start; i < length; ++i) {
+        if (!isOrdinaryCharacter(characters[i], delimiter))
+            return i;
+    }
+    return length;
+}
+
+#ifdef __SSE2__
+static inline unsigned ordinaryCharacterRunLength(const LChar* characters, unsigned length, UChar delimiter)
+{
+    ASSERT(delimiter <= 0x7F);
+    const __m128i delimiterVector = _mm_set1_epi8(static_cast<char>(delimiter));
+    const __m128i ampersandVector = _mm_set1_epi8('&');
+    const __m128i newlineVector = _mm_set1_epi8('\n');
+    const __m128i carriageReturnVector = _mm_set1_epi8('\r');
+    const __m128i zeroVector = _mm_setzero_si128();
+
+    unsigned i = 0;
+    for (; i + sizeof(__m128i) <= length; i += sizeof(__m128i)) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(characters + i));
+        __m128i matches = _mm_or_si128(_mm_cmpeq_epi8(chunk, delimiterVector), _mm_cmpeq_epi8(chunk, ampersandVector));
+        matches = _mm_or_si128(matches, _mm_or_si128(_mm_cmpeq_epi8(chunk, newlineVector), _mm_cmpeq_epi8(chunk, carriageReturnVector)));
+        matches = _mm_or_si128(matches, _mm_cmpeq_epi8(chunk, zeroVector));
+        if (int mask = _mm_movemask_epi8(matches))
+            return i + __builtin_ctz(mask);
+    }
+    return ordinaryCharacterRunLength<LChar>(characters, length, delimiter, i);
+}
+
+static inline unsigned ordinaryCharacterRunLength(const UChar* characters, unsigned length, UChar delimiter)
+{
+    const __m128i delimiterVector = _mm_set1_epi16(static_cast<short>(delimiter));
+    const __m128i ampersandVector = _mm_set1_epi16('&');
+    const __m128i newlineVector = _mm_set1_epi16('\n');
+    const __m128i carriageReturnVector = _mm_set1_epi16('\r');
+    const __m128i zeroVector = _mm_setzero_si128();
+    const unsigned charactersPerChunk = sizeof(__m128i) / sizeof(UChar);
+
+    unsigned i = 0;
+    for (; i + charactersPerChunk <= length; i += charactersPerChunk) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(characters + i));
+        __m128i matches = _mm_or_si128(_mm_cmpeq_epi16(chunk, delimiterVector), _mm_cmpeq_epi16(chunk, ampersandVector));
+        matches = _mm_or_si128(matches, _mm_or_si128(_mm_cmpeq_epi16(chunk, newlineVector), _mm_cmpeq_epi16(chunk, carriageReturnVector)));
+        matches = _mm_or_si128(matches, _mm_cmpeq_epi16(chunk, zeroVector));
+        // The byte mask has two bits set for each matching character.
+        if (int mask = _mm_movemask_epi8(matches))
+            return i + __builtin_ctz(mask) / sizeof(UChar);
+    }
+    return ordinaryCharacterRunLength<UChar>(characters, length, delimiter, i);
+}
+#endif
+
+inline void HTMLTokenizer::bufferOrdinaryCharacters(SegmentedString& source, UChar currentCharacter)
+{
+    // The preprocessor may have rewritten the current character, and newlines
+    // have to go through advanceAndUpdateLineNumber().
+    if (currentCharacter != source.currentChar() || currentCharacter == '\n')
+        return;
+    unsigned length = source.lengthAfterCurrentCharInCurrentSubstring();
+    if (!length)
+        return;
+    unsigned runLength;
+    if (source.currentSubstringIs8Bit()) {
+        const LChar* characters = source.characters8AfterCurrentChar();
+        runLength = ordinaryCharacterRunLength(characters, length, '<');
+        m_token->appendToCharacter(characters, runLength);
+    } else {
+        const UChar* characters = source.characters16AfterCurrentChar();
+        runLength = ordinaryCharacterRunLength(characters, length, '<');
+        m_token->appendToCharacter(characters, runLength);
+    }
+    source.advancePastNonNewlines(runLength);
+}
+
+inline void HTMLTokenizer::appendOrdinaryCharactersToAttributeValue(SegmentedString& source, UChar currentCharacter, UChar quote)
+{
+    if (currentCharacter != source.currentChar() || currentCharacter == '\n')
+        return;
+    unsigned length = source.lengthAfterCurrentCharInCurrentSubstring();
+    if (!length)
+        return;
+    unsigned runLength;
+    if (source.currentSubstringIs8Bit()) {
+        const LChar* characters = source.characters8AfterCurrentChar();
+        runLength = ordinaryCharacterRunLength(characters, length, quote);
+        m_token->appendToAttributeValue(characters, runLength);
+    } else {
+        const UChar* characters = source.characters16AfterCurrentChar();
+        runLength = ordinaryCharacterRunLength(characters, length, quote);
+        m_token->appendToAttributeValue(characters, runLength);
+    }
+    source.advancePastNonNewlines(runLength);
+}
+
 bool HTMLTokenizer::flushEmitAndResumeIn(SegmentedString& source, HTMLTokenizer::State state)
 {
     m_state = state;
@@ -208,6 +317,7 @@ bool HTMLTokenizer::nextToken(SegmentedString& source, HTMLToken& token)
             return emitEndOfFile(source);
         else {
             bufferCharacter(cc);
+            bufferOrdinaryCharacters(source, cc);
             HTML_ADVANCE_TO(DataState);
         }
     }
@@ -924,6 +1034,7 @@ bool HTMLTokenizer::nextToken(SegmentedString& source, HTMLToken& token)
             HTML_RECONSUME_IN(DataState);
         } else {
             m_token->appendToAttributeValue(cc);
+            appendOrdinaryCharactersToAttributeValue(source, cc, '"');
             HTML_ADVANCE_TO(AttributeValueDoubleQuotedState);
         }
     }
@@ -942,6 +1053,7 @@ bool HTMLTokenizer::nextToken(SegmentedString& source, HTMLToken& token)
             HTML_RECONSUME_IN(DataState);
         } else {
             m_token->appendToAttributeValue(cc);
+            appendOrdinaryCharactersToAttributeValue(source, cc, '\'');
             HTML_ADVANCE_TO(AttributeValueSingleQuotedState);
         }
     }
@@ -177,6 +177,11 @@ private:
 
     inline void parseError();
 
+    // Consume the rest of a run of characters that need no per-character handling
+    // in one go, rather than looping through the state machine for each of them.
+    inline void bufferOrdinaryCharacters(SegmentedString&, UChar currentCharacter);
+    inline void appendOrdinaryCharactersToAttributeValue(SegmentedString&, UChar currentCharacter, UChar quote);
+
     inline void bufferCharacter(UChar character)
     {
         ASSERT(character != kEndOfFileMarker);
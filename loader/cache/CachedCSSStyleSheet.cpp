@@ -37,10 +37,96 @@
 #include "StyleSheetContents.h"
 #include "TextResourceDecoder.h"
 #include <wtf/CurrentTime.h>
+#include <wtf/ListHashSet.h>
+#include <wtf/NeverDestroyed.h>
 #include <wtf/Vector.h>
 
 namespace WebCore {
 
+// Parsed sheets outlive the resource they were parsed from, so that a stylesheet loaded again with the same
+// response validators (typically from the disk cache, after the memory cache evicted it) is not parsed again.
+struct RetainedParsedStyleSheet {
+    String validator;
+    unsigned encodedSize;
+    RefPtr<StyleSheetContents> sheet;
+};
+
+typedef HashMap<String, RetainedParsedStyleSheet> RetainedParsedStyleSheetMap;
+
+static const unsigned retainedParsedStyleSheetsCapacity = 4 * 1024 * 1024;
+static unsigned retainedParsedStyleSheetsSize;
+
+static RetainedParsedStyleSheetMap& retainedParsedStyleSheets()
+{
+    static NeverDestroyed<RetainedParsedStyleSheetMap> map;
+    return map;
+}
+
+// Least recently retained first.
+static ListHashSet<String>& retainedParsedStyleSheetURLs()
+{
+    static NeverDestroyed<ListHashSet<String>> urls;
+    return urls;
+}
+
+static String responseValidator(const ResourceResponse& response)
+{
+    const String& eTag = response.httpHeaderField(HTTPHeaderName::ETag);
+    if (!eTag.isEmpty())
+        return eTag;
+    return response.httpHeaderField(HTTPHeaderName::LastModified);
+}
+
+static PassRefPtr<StyleSheetContents> takeRetainedParsedStyleSheet(const String& url)
+{
+    auto it = retainedParsedStyleSheets().find(url);
+    if (it == retainedParsedStyleSheets().end())
+        return nullptr;
+    RefPtr<StyleSheetContents> sheet = it->value.sheet.release();
+    retainedParsedStyleSheetsSize -= sheet->estimatedSizeInBytes();
+    retainedParsedStyleSheets().remove(it);
+    retainedParsedStyleSheetURLs().remove(url);
+    return sheet.release();
+}
+
+static void retainParsedStyleSheet(const String& url, const String& validator, unsigned encodedSize, PassRefPtr<StyleSheetContents> sheet)
+{
+    unsigned size = sheet->estimatedSizeInBytes();
+    if (size > retainedParsedStyleSheetsCapacity) {
+        sheet->removedFromMemoryCache();
+        return;
+    }
+    if (RefPtr<StyleSheetContents> replacedSheet = takeRetainedParsedStyleSheet(url))
+        replacedSheet->removedFromMemoryCache();
+    while (retainedParsedStyleSheetsSize + size > retainedParsedStyleSheetsCapacity) {
+        RefPtr<StyleSheetContents> evictedSheet = takeRetainedParsedStyleSheet(retainedParsedStyleSheetURLs().first());
+        evictedSheet->removedFromMemoryCache();
+    }
+
+    RetainedParsedStyleSheet retainedSheet;
+    retainedSheet.validator = validator;
+    retainedSheet.encodedSize = encodedSize;
+    retainedSheet.sheet = sheet;
+    retainedParsedStyleSheets().add(url, retainedSheet);
+    retainedParsedStyleSheetURLs().add(url);
+    retainedParsedStyleSheetsSize += size;
+}
+
+void CachedCSSStyleSheet::clearRetainedParsedStyleSheets()
+{
+    for (auto& retainedSheet : retainedParsedStyleSheets().values())
+        retainedSheet.sheet->removedFromMemoryCache();
+    retainedParsedStyleSheets().clear();
+    retainedParsedStyleSheetURLs().clear();
+    retainedParsedStyleSheetsSize = 0;
+}
+
+bool CachedCSSStyleSheet::canRetainParsedStyleSheet() const
+{
+    // Without validators there is no way to tell that a later load of the same URL has the same contents.
+    return sessionID() == SessionID::defaultSessionID() && m_response.hasCacheValidatorFields() && !errorOccurred();
+}
+
 CachedCSSStyleSheet::CachedCSSStyleSheet(const ResourceRequest& resourceRequest, const String& charset, SessionID sessionID)
     : CachedResource(resourceRequest, CSSStyleSheet, sessionID)
     , m_decoder(TextResourceDecoder::create("text/css", charset))
@@ -52,7 +138,11 @@ CachedCSSStyleSheet::CachedCSSStyleSheet(const ResourceRequest& resourceRequest,
 
 CachedCSSStyleSheet::~CachedCSSStyleSheet()
 {
-    if (m_parsedStyleSheetCache)
+    if (!m_parsedStyleSheetCache)
+        return;
+    if (canRetainParsedStyleSheet() && !m_parsedStyleSheetCache->hasFailedOrCanceledSubresources())
+        retainParsedStyleSheet(url().string(), responseValidator(m_response), encodedSize(), m_parsedStyleSheetCache.release());
+    else
         m_parsedStyleSheetCache->removedFromMemoryCache();
 }
 
@@ -155,6 +245,8 @@ void CachedCSSStyleSheet::destroyDecodedData()
 
 PassRefPtr<StyleSheetContents> CachedCSSStyleSheet::restoreParsedStyleSheet(const CSSParserContext& context)
 {
+    if (!m_parsedStyleSheetCache)
+        restoreRetainedParsedStyleSheet();
     if (!m_parsedStyleSheetCache)
         return 0;
     if (m_parsedStyleSheetCache->hasFailedOrCanceledSubresources()) {
@@ -175,6 +267,24 @@ PassRefPtr<StyleSheetContents> CachedCSSStyleSheet::restoreParsedStyleSheet(cons
     return m_parsedStyleSheetCache;
 }
 
+void CachedCSSStyleSheet::restoreRetainedParsedStyleSheet()
+{
+    ASSERT(!m_parsedStyleSheetCache);
+    if (isLoading() || !canRetainParsedStyleSheet())
+        return;
+    auto it = retainedParsedStyleSheets().find(url().string());
+    if (it == retainedParsedStyleSheets().end())
+        return;
+    if (it->value.validator != responseValidator(m_response) || it->value.encodedSize != encodedSize()) {
+        takeRetainedParsedStyleSheet(url().string())->removedFromMemoryCache();
+        return;
+    }
+
+    // The sheet stays marked as being in the memory cache while it is retained.
+    m_parsedStyleSheetCache = takeRetainedParsedStyleSheet(url().string());
+    setDecodedSize(m_parsedStyleSheetCache->estimatedSizeInBytes());
+}
+
 void CachedCSSStyleSheet::saveParsedStyleSheet(PassRef<StyleSheetContents> sheet)
 {
     ASSERT(sheet.get().isCacheable());
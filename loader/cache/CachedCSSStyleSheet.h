@@ -46,8 +46,13 @@ namespace WebCore {
         PassRefPtr<StyleSheetContents> restoreParsedStyleSheet(const CSSParserContext&);
         void saveParsedStyleSheet(PassRef<StyleSheetContents>);
 
+        // Drops the parsed sheets kept for stylesheets that are no longer in the memory cache.
+        static void clearRetainedParsedStyleSheets();
+
     private:
         bool canUseSheet(bool enforceMIMEType, bool* hasValidMIMEType) const;
+        bool canRetainParsedStyleSheet() const;
+        void restoreRetainedParsedStyleSheet();
         virtual PurgePriority purgePriority() const override { return PurgeLast; }
         virtual bool mayTryReplaceEncodedData() const override { return true; }
 
@@ -69,6 +69,7 @@ namespace WebCore {
     M(SQLDatabase) \
     M(SpellingAndGrammar) \
     M(StorageAPI) \
+    M(Styles) \
     M(Threading) \
     M(WebAudio) \
     M(WebGL) \
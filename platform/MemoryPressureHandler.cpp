@@ -27,6 +27,7 @@
 #include "MemoryPressureHandler.h"
 
 #include "CSSValuePool.h"
+#include "CachedCSSStyleSheet.h"
 #include "Document.h"
 #include "Font.h"
 #include "FontCache.h"
@@ -80,6 +81,11 @@ void MemoryPressureHandler::releaseNoncriticalMemory()
         clearWidthCaches();
     }
 
+    {
+        ReliefLogger log("Discard retained parsed stylesheets");
+        CachedCSSStyleSheet::clearRetainedParsedStyleSheets();
+    }
+
     {
         ReliefLogger log("Discard Selector Query Cache");
         for (auto* document : Document::allDocuments())
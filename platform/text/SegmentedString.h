@@ -58,7 +58,7 @@ public:
 
     void clear() { m_length = 0; m_data.string16Ptr = 0; m_is8Bit = false;}
     
-    bool is8Bit() { return m_is8Bit; }
+    bool is8Bit() const { return m_is8Bit; }
     
     bool excludeLineNumbers() const { return !m_doNotExcludeLineNumbers; }
     bool doNotExcludeLineNumbers() const { return m_doNotExcludeLineNumbers; }
@@ -290,6 +290,37 @@ public:
     // have space for at least |count| characters.
     void advance(unsigned count, UChar* consumedCharacters);
 
+    // Tokenizers can consume runs of characters that need no per-character handling
+    // directly from the current substring. There are none to scan while characters
+    // have been pushed back.
+    unsigned lengthAfterCurrentCharInCurrentSubstring() const
+    {
+        if (m_pushedChar1 || m_currentString.m_length < 2)
+            return 0;
+        return m_currentString.m_length - 1;
+    }
+    bool currentSubstringIs8Bit() const { return m_currentString.is8Bit(); }
+    const LChar* characters8AfterCurrentChar() const { return m_currentString.m_data.string8Ptr + 1; }
+    const UChar* characters16AfterCurrentChar() const { return m_currentString.m_data.string16Ptr + 1; }
+
+    // None of the current character and the |count| characters following it
+    // in the current substring may be newlines.
+    void advancePastNonNewlines(unsigned count)
+    {
+        ASSERT(currentChar() != '\n');
+        ASSERT(count <= lengthAfterCurrentCharInCurrentSubstring());
+        if (!count)
+            return;
+        m_currentString.m_length -= count;
+        if (m_currentString.is8Bit())
+            m_currentString.m_data.string8Ptr += count;
+        else
+            m_currentString.m_data.string16Ptr += count;
+        m_currentChar = m_currentString.getCurrentChar();
+        if (m_currentString.m_length == 1)
+            updateSlowCaseFunctionPointers();
+    }
+
     bool escaped() const { return m_pushedChar1; }
 
     int numberOfCharactersConsumed() const
@@ -57,7 +57,7 @@ void AutoTableLayout::recalcColumn(unsigned effCol)
             RenderTableSection* section = toRenderTableSection(child);
             unsigned numRows = section->numRows();
             for (unsigned i = 0; i < numRows; i++) {
-                RenderTableSection::CellStruct current = section->cellAt(i, effCol);
+                RenderTableSection::CellStruct& current = section->cellAt(i, effCol);
                 RenderTableCell* cell = current.primaryCell();
                 
                 if (current.inColSpan || !cell)
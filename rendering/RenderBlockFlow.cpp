@@ -638,8 +638,11 @@ void RenderBlockFlow::layoutBlockChildren(bool relayoutChildren, LayoutUnit& max
 
 void RenderBlockFlow::layoutInlineChildren(bool relayoutChildren, LayoutUnit& repaintLogicalTop, LayoutUnit& repaintLogicalBottom)
 {
-    if (m_lineLayoutPath == UndeterminedPath)
-        m_lineLayoutPath = SimpleLineLayout::canUseFor(*this) ? SimpleLinesPath : LineBoxesPath;
+    if (m_lineLayoutPath == UndeterminedPath) {
+        SimpleLineLayout::AvoidanceReason reason = SimpleLineLayout::canUseForWithReason(*this);
+        SimpleLineLayout::didChooseLineLayoutPath(reason);
+        m_lineLayoutPath = reason == SimpleLineLayout::NoAvoidanceReason ? SimpleLinesPath : LineBoxesPath;
+    }
 
     if (m_lineLayoutPath == SimpleLinesPath) {
         deleteLineBoxesBeforeSimpleLineLayout();
@@ -1962,6 +1965,9 @@ void RenderBlockFlow::styleDidChange(StyleDifference diff, const RenderStyle* ol
         fragment->setStyle(RenderNamedFlowFragment::createStyle(style()));
 
     if (diff >= StyleDifferenceRepaint) {
+        // The runs may depend on the old style even when the simple line layout itself stays valid.
+        if (m_simpleLineLayout)
+            m_simpleLineLayout->setIsReusable(false);
         // FIXME: This could use a cheaper style-only test instead of SimpleLineLayout::canUseFor.
         if (selfNeedsLayout() || !m_simpleLineLayout || !SimpleLineLayout::canUseFor(*this))
             invalidateLineLayoutPath();
@@ -3432,7 +3438,9 @@ void RenderBlockFlow::layoutSimpleLines(LayoutUnit& repaintLogicalTop, LayoutUni
 {
     ASSERT(!m_lineBoxes.firstLineBox());
 
-    m_simpleLineLayout = SimpleLineLayout::create(*this);
+    // Relayouts that only move the block or change its height keep the line breaks from last time.
+    if (!m_simpleLineLayout || !SimpleLineLayout::canReuse(*m_simpleLineLayout, *this))
+        m_simpleLineLayout = SimpleLineLayout::create(*this);
 
     LayoutUnit lineLayoutHeight = SimpleLineLayout::computeFlowHeight(*this, *m_simpleLineLayout);
     LayoutUnit lineLayoutTop = borderAndPaddingBefore();
@@ -89,26 +89,26 @@ class RenderGrid::GridIterator {
 public:
     // |direction| is the direction that is fixed to |fixedTrackIndex| so e.g
     // GridIterator(m_grid, ForColumns, 1) will walk over the rows of the 2nd column.
-    GridIterator(const Vector<Vector<Vector<RenderBox*, 1>>>& grid, GridTrackSizingDirection direction, size_t fixedTrackIndex, size_t varyingTrackIndex = 0)
+    GridIterator(const GridCells& grid, GridTrackSizingDirection direction, size_t fixedTrackIndex, size_t varyingTrackIndex = 0)
         : m_grid(grid)
         , m_direction(direction)
         , m_rowIndex((direction == ForColumns) ? varyingTrackIndex : fixedTrackIndex)
         , m_columnIndex((direction == ForColumns) ? fixedTrackIndex : varyingTrackIndex)
         , m_childIndex(0)
     {
-        ASSERT(m_rowIndex < m_grid.size());
-        ASSERT(m_columnIndex < m_grid[0].size());
+        ASSERT(m_rowIndex < m_grid.rowCount());
+        ASSERT(m_columnIndex < m_grid.columnCount());
     }
 
     RenderBox* nextGridItem()
     {
-        if (!m_grid.size())
+        if (m_grid.isEmpty())
             return 0;
 
         size_t& varyingTrackIndex = (m_direction == ForColumns) ? m_rowIndex : m_columnIndex;
-        const size_t endOfVaryingTrackIndex = (m_direction == ForColumns) ? m_grid.size() : m_grid[0].size();
+        const size_t endOfVaryingTrackIndex = (m_direction == ForColumns) ? m_grid.rowCount() : m_grid.columnCount();
         for (; varyingTrackIndex < endOfVaryingTrackIndex; ++varyingTrackIndex) {
-            const Vector<RenderBox*>& children = m_grid[m_rowIndex][m_columnIndex];
+            const GridCell& children = m_grid.cell(m_rowIndex, m_columnIndex);
             if (m_childIndex < children.size())
                 return children[m_childIndex++];
 
@@ -120,13 +120,13 @@ public:
     bool isEmptyAreaEnough(size_t rowSpan, size_t columnSpan) const
     {
         // Ignore cells outside current grid as we will grow it later if needed.
-        size_t maxRows = std::min(m_rowIndex + rowSpan, m_grid.size());
-        size_t maxColumns = std::min(m_columnIndex + columnSpan, m_grid[0].size());
+        size_t maxRows = std::min(m_rowIndex + rowSpan, m_grid.rowCount());
+        size_t maxColumns = std::min(m_columnIndex + columnSpan, m_grid.columnCount());
 
         // This adds a O(N^2) behavior that shouldn't be a big deal as we expect spanning areas to be small.
         for (size_t row = m_rowIndex; row < maxRows; ++row) {
             for (size_t column = m_columnIndex; column < maxColumns; ++column) {
-                const Vector<RenderBox*>& children = m_grid[row][column];
+                const GridCell& children = m_grid.cell(row, column);
                 if (!children.isEmpty())
                     return false;
             }
@@ -146,7 +146,7 @@ public:
         size_t columnSpan = (m_direction == ForColumns) ? fixedTrackSpan : varyingTrackSpan;
 
         size_t& varyingTrackIndex = (m_direction == ForColumns) ? m_rowIndex : m_columnIndex;
-        const size_t endOfVaryingTrackIndex = (m_direction == ForColumns) ? m_grid.size() : m_grid[0].size();
+        const size_t endOfVaryingTrackIndex = (m_direction == ForColumns) ? m_grid.rowCount() : m_grid.columnCount();
         for (; varyingTrackIndex < endOfVaryingTrackIndex; ++varyingTrackIndex) {
             if (isEmptyAreaEnough(rowSpan, columnSpan)) {
                 std::unique_ptr<GridCoordinate> result = std::make_unique<GridCoordinate>(GridSpan(m_rowIndex, m_rowIndex + rowSpan - 1), GridSpan(m_columnIndex, m_columnIndex + columnSpan - 1));
@@ -159,7 +159,7 @@ public:
     }
 
 private:
-    const Vector<Vector<Vector<RenderBox*, 1>>>& m_grid;
+    const GridCells& m_grid;
     GridTrackSizingDirection m_direction;
     size_t m_rowIndex;
     size_t m_columnIndex;
@@ -630,28 +630,53 @@ bool RenderGrid::tracksAreWiderThanMinTrackBreadth(GridTrackSizingDirection dire
 }
 #endif
 
-void RenderGrid::ensureGridSize(size_t maximumRowIndex, size_t maximumColumnIndex)
+void RenderGrid::GridCells::grow(size_t rowCount, size_t columnCount)
 {
-    const size_t oldRowCount = gridRowCount();
-    if (maximumRowIndex >= oldRowCount) {
-        m_grid.grow(maximumRowIndex + 1);
-        for (size_t row = oldRowCount; row < gridRowCount(); ++row)
-            m_grid[row].grow(gridColumnCount());
+    ASSERT(rowCount >= m_rowCount && columnCount >= m_columnCount);
+
+    if (columnCount > m_columnStride) {
+        // The new columns do not fit in the slack of each row, so move the cells into rows of a wider stride.
+        size_t columnStride = std::max(columnCount, 2 * m_columnStride);
+        Vector<GridCell> cells(m_rowCount * columnStride);
+        for (size_t row = 0; row < m_rowCount; ++row) {
+            for (size_t column = 0; column < m_columnCount; ++column)
+                cells[row * columnStride + column].swap(m_cells[row * m_columnStride + column]);
+        }
+        m_cells.swap(cells);
+        m_columnStride = columnStride;
     }
 
-    if (maximumColumnIndex >= gridColumnCount()) {
-        for (size_t row = 0; row < gridRowCount(); ++row)
-            m_grid[row].grow(maximumColumnIndex + 1);
+    // Slots past m_columnCount in each row are never written, so widening within the stride needs no work.
+    m_columnCount = columnCount;
+    if (rowCount > m_rowCount) {
+        m_cells.grow(rowCount * m_columnStride);
+        m_rowCount = rowCount;
     }
 }
 
+void RenderGrid::GridCells::clear()
+{
+    m_cells.clear();
+    m_rowCount = 0;
+    m_columnCount = 0;
+    m_columnStride = 0;
+}
+
+void RenderGrid::ensureGridSize(size_t maximumRowIndex, size_t maximumColumnIndex)
+{
+    if (maximumRowIndex < gridRowCount() && maximumColumnIndex < gridColumnCount())
+        return;
+
+    m_grid.grow(std::max(maximumRowIndex + 1, gridRowCount()), std::max(maximumColumnIndex + 1, gridColumnCount()));
+}
+
 void RenderGrid::insertItemIntoGrid(RenderBox* child, const GridCoordinate& coordinate)
 {
     ensureGridSize(coordinate.rows.resolvedFinalPosition.toInt(), coordinate.columns.resolvedFinalPosition.toInt());
 
     for (auto row : coordinate.rows) {
         for (auto column : coordinate.columns)
-            m_grid[row.toInt()][column.toInt()].append(child);
+            m_grid.cell(row.toInt(), column.toInt()).append(child);
     }
     m_gridItemCoordinate.set(child, coordinate);
 }
@@ -727,9 +752,7 @@ void RenderGrid::populateExplicitGridAndOrderIterator()
         }
     }
 
-    m_grid.grow(maximumRowIndex);
-    for (size_t i = 0; i < m_grid.size(); ++i)
-        m_grid[i].grow(maximumColumnIndex);
+    m_grid.grow(maximumRowIndex, maximumColumnIndex);
 }
 
 std::unique_ptr<GridCoordinate> RenderGrid::createEmptyGridAreaAtSpecifiedPositionsOutsideGrid(const RenderBox* gridItem, GridTrackSizingDirection specifiedDirection, const GridSpan& specifiedPositions) const
@@ -60,6 +60,46 @@ private:
     virtual void computeIntrinsicLogicalWidths(LayoutUnit& minLogicalWidth, LayoutUnit& maxLogicalWidth) const override;
     virtual void computePreferredLogicalWidths() override;
 
+    typedef Vector<RenderBox*, 1> GridCell;
+
+    // The grid is stored row-major in a single buffer so that walking a row, or the
+    // span of an item, touches neighbouring cells instead of chasing one heap
+    // allocation per row. Rows are |m_columnStride| cells apart; the stride grows
+    // geometrically so that adding columns one at a time stays amortized O(rows).
+    class GridCells {
+    public:
+        GridCells()
+            : m_rowCount(0)
+            , m_columnCount(0)
+            , m_columnStride(0)
+        {
+        }
+
+        bool isEmpty() const { return !m_rowCount || !m_columnCount; }
+        size_t rowCount() const { return m_rowCount; }
+        size_t columnCount() const { return m_columnCount; }
+
+        GridCell& cell(size_t row, size_t column)
+        {
+            ASSERT(row < m_rowCount && column < m_columnCount);
+            return m_cells[row * m_columnStride + column];
+        }
+        const GridCell& cell(size_t row, size_t column) const
+        {
+            ASSERT(row < m_rowCount && column < m_columnCount);
+            return m_cells[row * m_columnStride + column];
+        }
+
+        void grow(size_t rowCount, size_t columnCount);
+        void clear();
+
+    private:
+        Vector<GridCell> m_cells;
+        size_t m_rowCount;
+        size_t m_columnCount;
+        size_t m_columnStride;
+    };
+
     class GridIterator;
     class GridSizingData;
     void computeUsedBreadthOfGridTracks(GridTrackSizingDirection, GridSizingData&);
@@ -109,21 +149,21 @@ private:
 
 #ifndef NDEBUG
     bool tracksAreWiderThanMinTrackBreadth(GridTrackSizingDirection, const Vector<GridTrack>&);
-    bool gridWasPopulated() const { return !m_grid.isEmpty() && !m_grid[0].isEmpty(); }
+    bool gridWasPopulated() const { return !m_grid.isEmpty(); }
 #endif
 
     size_t gridColumnCount() const
     {
         ASSERT(gridWasPopulated());
-        return m_grid[0].size();
+        return m_grid.columnCount();
     }
     size_t gridRowCount() const
     {
         ASSERT(gridWasPopulated());
-        return m_grid.size();
+        return m_grid.rowCount();
     }
 
-    Vector<Vector<Vector<RenderBox*, 1>>> m_grid;
+    GridCells m_grid;
     Vector<LayoutUnit> m_columnPositions;
     Vector<LayoutUnit> m_rowPositions;
     HashMap<const RenderBox*, GridCoordinate> m_gridItemCoordinate;
@@ -311,19 +311,19 @@ int RenderTableSection::calcRowLogicalHeight()
                     // We will apply the height of the rowspan to the current row if next row is not valid.
                     if ((r + 1) < totalRows) {
                         unsigned col = 0;
-                        CellStruct nextRowCell = cellAt(r + 1, col);
+                        const CellStruct* nextRowCell = &cellAt(r + 1, col);
 
                         // We are trying to find that next row is valid or not.
-                        while (nextRowCell.cells.size() && nextRowCell.cells[0]->rowSpan() > 1 && nextRowCell.cells[0]->rowIndex() < (r + 1)) {
+                        while (nextRowCell->cells.size() && nextRowCell->cells[0]->rowSpan() > 1 && nextRowCell->cells[0]->rowIndex() < (r + 1)) {
                             col++;
                             if (col < totalCols)
-                                nextRowCell = cellAt(r + 1, col);
+                                nextRowCell = &cellAt(r + 1, col);
                             else
                                 break;
                         }
 
                         // We are adding the height of the rowspan to the current row if next row is not valid.
-                        if (col < totalCols && nextRowCell.cells.size())
+                        if (col < totalCols && nextRowCell->cells.size())
                             continue;
                     }
                 }
@@ -87,108 +87,132 @@ static bool canUseForText(const RenderText& textRenderer, const SimpleFontData&
     return canUseForText(textRenderer.characters16(), textRenderer.textLength(), fontData);
 }
 
-bool canUseFor(const RenderBlockFlow& flow)
+AvoidanceReason canUseForWithReason(const RenderBlockFlow& flow)
 {
     if (!flow.frame().settings().simpleLineLayoutEnabled())
-        return false;
+        return FeatureIsDisabled;
     if (!flow.firstChild())
-        return false;
+        return FlowHasNoChild;
     // This currently covers <blockflow>#text</blockflow> case.
     // The <blockflow><inline>#text</inline></blockflow> case is also popular and should be relatively easy to cover.
     if (flow.firstChild() != flow.lastChild())
-        return false;
+        return FlowHasMultipleChildren;
     if (!flow.firstChild()->isText())
-        return false;
+        return FlowChildIsNotText;
     if (!flow.isHorizontalWritingMode())
-        return false;
+        return FlowIsNotHorizontal;
     if (flow.flowThreadState() != RenderObject::NotInsideFlowThread)
-        return false;
+        return FlowIsInsideFlowThread;
     // Printing does pagination without a flow thread.
     if (flow.document().paginated())
-        return false;
+        return FlowIsPaginated;
     if (flow.hasOutline())
-        return false;
+        return FlowHasOutline;
     if (flow.isRubyText() || flow.isRubyBase())
-        return false;
+        return FlowIsRuby;
     if (flow.parent()->isDeprecatedFlexibleBox())
-        return false;
+        return FlowParentIsDeprecatedFlexibleBox;
     // FIXME: Implementation of wrap=hard looks into lineboxes.
     if (flow.parent()->isTextArea() && flow.parent()->element()->fastHasAttribute(HTMLNames::wrapAttr))
-        return false;
+        return FlowParentIsTextAreaWithWrapping;
     // FIXME: Placeholders do something strange.
     if (flow.parent()->isTextControl() && toRenderTextControl(*flow.parent()).textFormControlElement().placeholderElement())
-        return false;
+        return FlowParentIsPlaceholderTextControl;
     const RenderStyle& style = flow.style();
     if (style.textDecorationsInEffect() != TextDecorationNone)
-        return false;
+        return FlowHasTextDecoration;
     if (style.textAlign() == JUSTIFY)
-        return false;
+        return FlowHasJustifiedText;
     // Non-visible overflow should be pretty easy to support.
     if (style.overflowX() != OVISIBLE || style.overflowY() != OVISIBLE)
-        return false;
-    if (!style.textIndent().isZero())
-        return false;
+        return FlowHasOverflowClip;
+    // Negative indentation would need the overflow rect to extend past the content box.
+    if (style.textIndent().isNegative())
+        return FlowHasNegativeTextIndent;
     if (!style.wordSpacing().isZero() || style.letterSpacing())
-        return false;
+        return FlowHasWordOrLetterSpacing;
     if (style.textTransform() != TTNONE)
-        return false;
+        return FlowHasTextTransform;
     if (!style.isLeftToRightDirection())
-        return false;
+        return FlowIsNotLTR;
     if (style.lineBoxContain() != RenderStyle::initialLineBoxContain())
-        return false;
+        return FlowHasLineBoxContainProperty;
     if (style.writingMode() != TopToBottomWritingMode)
-        return false;
-    if (style.lineBreak() != LineBreakAuto)
-        return false;
-    if (style.wordBreak() != NormalWordBreak)
-        return false;
+        return FlowIsNotHorizontal;
+    if (style.lineBreak() != LineBreakAuto || style.wordBreak() != NormalWordBreak || style.hyphens() == HyphensAuto)
+        return FlowHasUnsupportedLineBreaking;
     if (style.unicodeBidi() != UBNormal || style.rtlOrdering() != LogicalOrder)
-        return false;
+        return FlowHasUnicodeBidi;
     if (style.lineAlign() != LineAlignNone || style.lineSnap() != LineSnapNone)
-        return false;
-    if (style.hyphens() == HyphensAuto)
-        return false;
+        return FlowHasLineAlignOrSnap;
     if (style.textEmphasisFill() != TextEmphasisFillFilled || style.textEmphasisMark() != TextEmphasisMarkNone)
-        return false;
+        return FlowHasTextEmphasis;
     if (style.textShadow())
-        return false;
+        return FlowHasTextShadow;
     if (style.textOverflow() || (flow.isAnonymousBlock() && flow.parent()->style().textOverflow()))
-        return false;
+        return FlowHasTextOverflow;
     if (style.hasPseudoStyle(FIRST_LINE) || style.hasPseudoStyle(FIRST_LETTER))
-        return false;
+        return FlowHasFirstLineOrFirstLetter;
     if (style.hasTextCombine())
-        return false;
+        return FlowHasTextCombine;
     if (style.backgroundClip() == TextFillBox)
-        return false;
+        return FlowHasBackgroundClipText;
     if (style.borderFit() == BorderFitLines)
-        return false;
+        return FlowHasBorderFitLines;
     const RenderText& textRenderer = toRenderText(*flow.firstChild());
     if (flow.containsFloats()) {
+        // The indented first line is narrower than the widths checked below.
+        if (!style.textIndent().isZero())
+            return FlowHasFloatsNeedingLineShift;
         // We can't use the code path if any lines would need to be shifted below floats. This is because we don't keep per-line y coordinates.
         float minimumWidthNeeded = textRenderer.minLogicalWidth();
         for (auto& floatRenderer : *flow.floatingObjectSet()) {
             ASSERT(floatRenderer);
             float availableWidth = flow.availableLogicalWidthForLine(floatRenderer->y(), false);
             if (availableWidth < minimumWidthNeeded)
-                return false;
+                return FlowHasFloatsNeedingLineShift;
         }
     }
     if (textRenderer.isCombineText() || textRenderer.isCounter() || textRenderer.isQuote() || textRenderer.isTextFragment()
         || textRenderer.isSVGInlineText())
-        return false;
+        return TextIsGeneratedOrSpecial;
     if (style.font().codePath(TextRun(textRenderer.text())) != Font::Simple)
-        return false;
+        return TextNeedsComplexCodePath;
     if (style.font().primaryFont()->isSVGFont())
-        return false;
+        return TextHasSVGFont;
 
     // We assume that all lines have metrics based purely on the primary font.
     auto& primaryFontData = *style.font().primaryFont();
     if (primaryFontData.isLoading())
-        return false;
+        return TextFontIsLoading;
     if (!canUseForText(textRenderer, primaryFontData))
-        return false;
+        return TextHasUnsupportedCharacter;
 
-    return true;
+    return NoAvoidanceReason;
+}
+
+static unsigned avoidanceReasonCounts[NumberOfAvoidanceReasons];
+
+void didChooseLineLayoutPath(AvoidanceReason reason)
+{
+    ++avoidanceReasonCounts[reason];
+}
+
+unsigned lineLayoutPathCount(AvoidanceReason reason)
+{
+    return avoidanceReasonCounts[reason];
+}
+
+const char* avoidanceReasonName(AvoidanceReason reason)
+{
+    static const char* const names[] = {
+        "NoAvoidanceReason",
+#define DEFINE_AVOIDANCE_REASON_NAME(name) #name,
+        FOR_EACH_SIMPLE_LINE_LAYOUT_AVOIDANCE_REASON(DEFINE_AVOIDANCE_REASON_NAME)
+#undef DEFINE_AVOIDANCE_REASON_NAME
+    };
+    COMPILE_ASSERT(WTF_ARRAY_LENGTH(names) == NumberOfAvoidanceReasons, AvoidanceReasonNamesMatchEnum);
+    return names[reason];
 }
 
 struct Style {
@@ -416,7 +440,9 @@ void createTextRuns(Layout::RunVector& runs, unsigned& lineCount, RenderBlockFlo
 
         // LineWidth reads the current y position from the flow so keep it updated.
         flow.setLogicalHeight(lineHeight * lineCount + borderAndPaddingBefore);
-        LineWidth lineWidth(flow, false, DoNotIndentText);
+        bool isFirstLine = !lineCount;
+        bool isAfterHardLineBreak = style.preserveNewline && lineStart && text[lineStart - 1] == '\n';
+        LineWidth lineWidth(flow, isFirstLine, requiresIndent(isFirstLine, isAfterHardLineBreak, flow.style()));
 
         auto lineRuns = createLineRuns(lineStart, lineWidth, lineBreakIterator, style, text, textLength, textRenderer);
 
@@ -451,7 +477,24 @@ std::unique_ptr<Layout> create(RenderBlockFlow& flow)
 
     textRenderer.clearNeedsLayout();
 
-    return Layout::create(runs, lineCount);
+    auto layout = Layout::create(runs, lineCount);
+    // With floats or a relative indent the line widths depend on more than the content box.
+    if (!flow.containsFloats() && flow.style().textIndent().isFixed()) {
+        layout->setContentLogicalLeftAndRight(flow.logicalLeftOffsetForContent().toFloat(), flow.logicalRightOffsetForContent().toFloat());
+        layout->setIsReusable(true);
+    }
+    return layout;
+}
+
+bool canReuse(const Layout& layout, const RenderBlockFlow& flow)
+{
+    if (!layout.isReusable())
+        return false;
+    if (flow.containsFloats())
+        return false;
+    if (flow.firstChild()->selfNeedsLayout())
+        return false;
+    return layout.contentLogicalLeft() == flow.logicalLeftOffsetForContent().toFloat() && layout.contentLogicalRight() == flow.logicalRightOffsetForContent().toFloat();
 }
 
 std::unique_ptr<Layout> Layout::create(const RunVector& runVector, unsigned lineCount)
@@ -463,6 +506,9 @@ std::unique_ptr<Layout> Layout::create(const RunVector& runVector, unsigned line
 Layout::Layout(const RunVector& runVector, unsigned lineCount)
     : m_lineCount(lineCount)
     , m_runCount(runVector.size())
+    , m_isReusable(false)
+    , m_contentLogicalLeft(0)
+    , m_contentLogicalRight(0)
 {
     memcpy(m_runs, runVector.data(), m_runCount * sizeof(Run));
 }
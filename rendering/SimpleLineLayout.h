@@ -40,7 +40,60 @@ class RenderBlockFlow;
 
 namespace SimpleLineLayout {
 
-bool canUseFor(const RenderBlockFlow&);
+#define FOR_EACH_SIMPLE_LINE_LAYOUT_AVOIDANCE_REASON(macro) \
+    macro(FeatureIsDisabled) \
+    macro(FlowHasNoChild) \
+    macro(FlowHasMultipleChildren) \
+    macro(FlowChildIsNotText) \
+    macro(FlowIsNotHorizontal) \
+    macro(FlowIsInsideFlowThread) \
+    macro(FlowIsPaginated) \
+    macro(FlowHasOutline) \
+    macro(FlowIsRuby) \
+    macro(FlowParentIsDeprecatedFlexibleBox) \
+    macro(FlowParentIsTextAreaWithWrapping) \
+    macro(FlowParentIsPlaceholderTextControl) \
+    macro(FlowHasTextDecoration) \
+    macro(FlowHasJustifiedText) \
+    macro(FlowHasOverflowClip) \
+    macro(FlowHasNegativeTextIndent) \
+    macro(FlowHasWordOrLetterSpacing) \
+    macro(FlowHasTextTransform) \
+    macro(FlowIsNotLTR) \
+    macro(FlowHasLineBoxContainProperty) \
+    macro(FlowHasUnsupportedLineBreaking) \
+    macro(FlowHasUnicodeBidi) \
+    macro(FlowHasLineAlignOrSnap) \
+    macro(FlowHasTextEmphasis) \
+    macro(FlowHasTextShadow) \
+    macro(FlowHasTextOverflow) \
+    macro(FlowHasFirstLineOrFirstLetter) \
+    macro(FlowHasTextCombine) \
+    macro(FlowHasBackgroundClipText) \
+    macro(FlowHasBorderFitLines) \
+    macro(FlowHasFloatsNeedingLineShift) \
+    macro(TextIsGeneratedOrSpecial) \
+    macro(TextNeedsComplexCodePath) \
+    macro(TextHasSVGFont) \
+    macro(TextFontIsLoading) \
+    macro(TextHasUnsupportedCharacter)
+
+enum AvoidanceReason {
+    NoAvoidanceReason,
+#define DEFINE_AVOIDANCE_REASON(name) name,
+    FOR_EACH_SIMPLE_LINE_LAYOUT_AVOIDANCE_REASON(DEFINE_AVOIDANCE_REASON)
+#undef DEFINE_AVOIDANCE_REASON
+    NumberOfAvoidanceReasons
+};
+
+AvoidanceReason canUseForWithReason(const RenderBlockFlow&);
+inline bool canUseFor(const RenderBlockFlow& flow) { return canUseForWithReason(flow) == NoAvoidanceReason; }
+
+// Counts the line layout path decisions made by RenderBlockFlow::layoutInlineChildren(). The count for
+// NoAvoidanceReason is the number of flows laid out with simple lines.
+void didChooseLineLayoutPath(AvoidanceReason);
+unsigned lineLayoutPathCount(AvoidanceReason);
+const char* avoidanceReasonName(AvoidanceReason);
 
 struct Run {
     Run() { }
@@ -70,15 +123,28 @@ public:
     unsigned runCount() const { return m_runCount; }
     const Run& runAt(unsigned i) const { return m_runs[i]; }
 
+    // The content box the lines were broken against. Only set when every line spans the whole content box.
+    bool isReusable() const { return m_isReusable; }
+    void setIsReusable(bool isReusable) { m_isReusable = isReusable; }
+    float contentLogicalLeft() const { return m_contentLogicalLeft; }
+    float contentLogicalRight() const { return m_contentLogicalRight; }
+    void setContentLogicalLeftAndRight(float left, float right) { m_contentLogicalLeft = left; m_contentLogicalRight = right; }
+
 private:
     Layout(const RunVector&, unsigned lineCount);
 
     unsigned m_lineCount;
     unsigned m_runCount;
+    bool m_isReusable;
+    float m_contentLogicalLeft;
+    float m_contentLogicalRight;
     Run m_runs[0];
 };
 
 std::unique_ptr<Layout> create(RenderBlockFlow&);
+// Returns true if the layout's runs are still correct for the flow: neither the text nor the style changed
+// since it was created and every line still has the same position and width.
+bool canReuse(const Layout&, const RenderBlockFlow&);
 
 }
 }
@@ -45,6 +45,7 @@
 #include "RenderView.h"
 #include "RenderWidget.h"
 #include "ResourceLoadScheduler.h"
+#include "RuleFeature.h"
 #include "Settings.h"
 #include "ShadowRoot.h"
 #include "StyleResolveForDocument.h"
@@ -91,6 +92,9 @@ static void detachRenderTree(Element&, DetachType);
 static void resolveTextNode(Text&, ContainerNode& renderingParentNode, RenderTreePosition&);
 static void resolveTree(Element&, ContainerNode& renderingParentNode, RenderTreePosition&, Change);
 
+static unsigned invalidatedElements;
+static unsigned styleChangedElements;
+
 Change determineChange(const RenderStyle* s1, const RenderStyle* s2)
 {
     if (!s1 || !s2)
@@ -723,6 +727,8 @@ static Change resolveLocal(Element& current, ContainerNode& renderingParentNode,
         newStyle = styleForElement(current, renderingParentNode);
         localChange = determineChange(currentStyle.get(), newStyle.get());
     }
+    if (localChange != NoChange)
+        ++styleChangedElements;
     if (localChange == Detach) {
         if (current.renderer() || current.isNamedFlowContentNode())
             detachRenderTree(current, ReattachDetach);
@@ -961,7 +967,10 @@ void resolveTree(Document& document, Change change)
     if (change < Inherit && !documentElement->childNeedsStyleRecalc() && !documentElement->needsStyleRecalc())
         return;
     RenderTreePosition renderTreePosition(document.renderView());
+    document.ensureStyleResolver().setStyleSharingIndexEnabled(true);
     resolveTree(*documentElement, document, renderTreePosition, change);
+    if (StyleResolver* styleResolver = document.styleResolverIfExists())
+        styleResolver->setStyleSharingIndexEnabled(false);
 }
 
 void detachRenderTree(Element& element)
@@ -969,6 +978,57 @@ void detachRenderTree(Element& element)
     detachRenderTree(element, NormalDetach);
 }
 
+static bool elementMatchesInvalidationSet(const Element& element, const DescendantInvalidationSet& invalidationSet)
+{
+    if (!invalidationSet.tagNames.isEmpty()) {
+        // Tag names in selectors are lowercased for HTML documents, which does not match the case of foreign elements.
+        if (!element.isHTMLElement() || invalidationSet.tagNames.contains(element.localName().impl()))
+            return true;
+    }
+    if (!invalidationSet.ids.isEmpty() && element.hasID() && invalidationSet.ids.contains(element.idForStyleResolution().impl()))
+        return true;
+    if (!invalidationSet.classes.isEmpty() && element.hasClass()) {
+        const SpaceSplitString& classNames = element.classNames();
+        for (unsigned i = 0; i < classNames.size(); ++i) {
+            if (invalidationSet.classes.contains(classNames[i].impl()))
+                return true;
+        }
+    }
+    return false;
+}
+
+void invalidateStyleForChangedFeatures(Element& element, const DescendantInvalidationSet& invalidationSet)
+{
+    ++invalidatedElements;
+    if (invalidationSet.invalidatesWholeSubtree) {
+        element.setNeedsStyleRecalc();
+        return;
+    }
+
+    // InlineStyleChange recomputes the element's own style without forcing its descendants. Descendants still
+    // inherit any change through the regular Inherit propagation in resolveTree().
+    element.setNeedsStyleRecalc(InlineStyleChange);
+    if (invalidationSet.isEmpty())
+        return;
+
+    for (auto& descendant : descendantsOfType<Element>(element)) {
+        if (descendant.styleChangeType() >= InlineStyleChange || !elementMatchesInvalidationSet(descendant, invalidationSet))
+            continue;
+        ++invalidatedElements;
+        descendant.setNeedsStyleRecalc(InlineStyleChange);
+    }
+}
+
+unsigned invalidatedElementCount()
+{
+    return invalidatedElements;
+}
+
+unsigned styleChangedElementCount()
+{
+    return styleChangedElements;
+}
+
 static Vector<std::function<void ()>>& postResolutionCallbackQueue()
 {
     static NeverDestroyed<Vector<std::function<void ()>>> vector;
@@ -35,6 +35,7 @@ class Element;
 class RenderStyle;
 class Settings;
 class Text;
+struct DescendantInvalidationSet;
 
 namespace Style {
 
@@ -49,6 +50,14 @@ void updateTextRendererAfterContentChange(Text&, unsigned offsetOfReplacedData,
 
 Change determineChange(const RenderStyle*, const RenderStyle*);
 
+// Marks an element whose id, class or attribute changed, and the descendants the change can affect, as needing style recalc.
+void invalidateStyleForChangedFeatures(Element&, const DescendantInvalidationSet&);
+
+// Debugging counters for targeted invalidation: elements marked by invalidateStyleForChangedFeatures() and elements
+// whose style was found to differ when it was recomputed.
+unsigned invalidatedElementCount();
+unsigned styleChangedElementCount();
+
 void queuePostResolutionCallback(std::function<void ()>);
 bool postResolutionCallbacksAreSuspended();
 
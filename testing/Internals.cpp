@@ -31,6 +31,7 @@
 #include "AnimationController.h"
 #include "ApplicationCacheStorage.h"
 #include "BackForwardController.h"
+#include "CSSStyleSheet.h"
 #include "CachedResourceLoader.h"
 #include "Chrome.h"
 #include "ChromeClient.h"
@@ -53,6 +54,7 @@
 #include "HTMLIFrameElement.h"
 #include "HTMLInputElement.h"
 #include "HTMLNames.h"
+#include "HTMLParserScheduler.h"
 #include "HTMLPlugInElement.h"
 #include "HTMLSelectElement.h"
 #include "HTMLTextAreaElement.h"
@@ -74,6 +76,7 @@
 #include "MediaSessionManager.h"
 #include "MemoryCache.h"
 #include "MemoryInfo.h"
+#include "MutationObserver.h"
 #include "Page.h"
 #include "PrintContext.h"
 #include "PseudoElement.h"
@@ -85,12 +88,18 @@
 #include "RuntimeEnabledFeatures.h"
 #include "SchemeRegistry.h"
 #include "ScrollingCoordinator.h"
+#include "SelectorCompiler.h"
+#include "SelectorQuery.h"
 #include "SerializedScriptValue.h"
 #include "Settings.h"
 #include "ShadowRoot.h"
+#include "SimpleLineLayout.h"
 #include "SourceBuffer.h"
 #include "SpellChecker.h"
 #include "StaticNodeList.h"
+#include "StyleResolveTree.h"
+#include "StyleResolver.h"
+#include "StyleRule.h"
 #include "StyleSheetContents.h"
 #include "TextIterator.h"
 #include "TreeScope.h"
@@ -1446,6 +1455,123 @@ unsigned Internals::numberOfLiveDocuments() const
     return Document::allDocuments().size();
 }
 
+unsigned Internals::invalidatedElementCount() const
+{
+    return Style::invalidatedElementCount();
+}
+
+unsigned Internals::styleChangedElementCount() const
+{
+    return Style::styleChangedElementCount();
+}
+
+unsigned Internals::styleSharingAttemptCount() const
+{
+    return StyleResolver::styleSharingAttemptCount();
+}
+
+unsigned Internals::styleSharingHitCount() const
+{
+    return StyleResolver::styleSharingHitCount();
+}
+
+unsigned Internals::styleSharingIndexHitCount() const
+{
+    return StyleResolver::styleSharingIndexHitCount();
+}
+
+unsigned Internals::matchedPropertiesCacheHitCount() const
+{
+    return StyleResolver::matchedPropertiesCacheHitCount();
+}
+
+unsigned Internals::matchedPropertiesCacheMissCount() const
+{
+    return StyleResolver::matchedPropertiesCacheMissCount();
+}
+
+unsigned Internals::matchedPropertiesCacheSize() const
+{
+    Document* document = contextDocument();
+    if (!document || !document->styleResolverIfExists())
+        return 0;
+    return document->styleResolverIfExists()->matchedPropertiesCacheSize();
+}
+
+unsigned Internals::matchedPropertiesCacheSizeInBytes() const
+{
+    Document* document = contextDocument();
+    if (!document || !document->styleResolverIfExists())
+        return 0;
+    size_t sizeInBytes = document->styleResolverIfExists()->matchedPropertiesCacheSizeInBytes();
+    return static_cast<unsigned>(std::min<size_t>(sizeInBytes, std::numeric_limits<unsigned>::max()));
+}
+
+unsigned Internals::simpleLineLayoutFlowCount() const
+{
+    return SimpleLineLayout::lineLayoutPathCount(SimpleLineLayout::NoAvoidanceReason);
+}
+
+unsigned Internals::simpleLineLayoutAvoidanceCount(const String& reason) const
+{
+    for (unsigned i = SimpleLineLayout::NoAvoidanceReason + 1; i < SimpleLineLayout::NumberOfAvoidanceReasons; ++i) {
+        auto avoidanceReason = static_cast<SimpleLineLayout::AvoidanceReason>(i);
+        if (reason == SimpleLineLayout::avoidanceReasonName(avoidanceReason))
+            return SimpleLineLayout::lineLayoutPathCount(avoidanceReason);
+    }
+    return 0;
+}
+
+unsigned Internals::mutationObserverEnqueuedRecordCount(MutationObserver* observer) const
+{
+    return observer ? observer->enqueuedRecordCount() : 0;
+}
+
+unsigned Internals::mutationObserverCoalescedRecordCount(MutationObserver* observer) const
+{
+    return observer ? observer->coalescedRecordCount() : 0;
+}
+
+unsigned Internals::mutationObserverDroppedRecordCount(MutationObserver* observer) const
+{
+    return observer ? observer->droppedRecordCount() : 0;
+}
+
+unsigned Internals::mutationObserverQueuedRecordBytes(MutationObserver* observer) const
+{
+    return observer ? observer->queuedRecordBytes() : 0;
+}
+
+unsigned Internals::selectorQueryIndexHitCount() const
+{
+    return SelectorQuery::indexedQueryCount();
+}
+
+unsigned Internals::selectorQueryIndexBuildCount() const
+{
+    return TreeScope::elementIndexListBuildCount();
+}
+
+unsigned Internals::parserPumpSessionCount() const
+{
+    return HTMLParserScheduler::pumpSessionCount();
+}
+
+unsigned Internals::parserPumpedTokenCount() const
+{
+    return HTMLParserScheduler::pumpedTokenCount();
+}
+
+unsigned Internals::parserYieldCount(const String& reason) const
+{
+    for (unsigned i = 0; i < numberOfPumpYieldReasons; ++i) {
+        auto yieldReason = static_cast<PumpYieldReason>(i);
+        if (reason == HTMLParserScheduler::yieldReasonName(yieldReason))
+            return HTMLParserScheduler::yieldCount(yieldReason);
+    }
+    return 0;
+}
+
 #if ENABLE(INSPECTOR)
 Vector<String> Internals::consoleMessageArgumentCounts() const
 {
@@ -1703,6 +1829,51 @@ void Internals::insertUserCSS(const String& css, ExceptionCode& ec) const
     document->styleSheetCollection().addUserSheet(WTF::move(parsedSheet));
 }
 
+#if ENABLE(CSS_SELECTOR_JIT)
+static void appendSelectorCompilationReport(StringBuilder& report, unsigned& compiledCount, unsigned& fallbackCount, const Vector<RefPtr<StyleRuleBase>>& rules)
+{
+    for (const auto& rule : rules) {
+        if (rule->isMediaRule() || rule->isSupportsRule()) {
+            appendSelectorCompilationReport(report, compiledCount, fallbackCount, static_cast<StyleRuleGroup&>(*rule).childRules());
+            continue;
+        }
+        if (!rule->isStyleRule())
+            continue;
+        const CSSSelectorList& selectorList = static_cast<StyleRule&>(*rule).selectorList();
+        for (const CSSSelector* selector = selectorList.first(); selector; selector = CSSSelectorList::next(selector)) {
+            if (SelectorCompiler::selectorCompilationStatus(selector, SelectorCompiler::SelectorContext::RuleCollector) == SelectorCompilationStatus::CannotCompile) {
+                report.appendLiteral("fallback: ");
+                ++fallbackCount;
+            } else {
+                report.appendLiteral("compiled: ");
+                ++compiledCount;
+            }
+            report.append(selector->selectorText());
+            report.append('\n');
+        }
+    }
+}
+
+String Internals::selectorCompilationReport(CSSStyleSheet* sheet, ExceptionCode& ec) const
+{
+    if (!sheet) {
+        ec = INVALID_ACCESS_ERR;
+        return String();
+    }
+
+    StringBuilder report;
+    unsigned compiledCount = 0;
+    unsigned fallbackCount = 0;
+    appendSelectorCompilationReport(report, compiledCount, fallbackCount, sheet->contents().childRules());
+    report.appendLiteral("compiled selectors: ");
+    report.appendNumber(compiledCount);
+    report.appendLiteral(", fallback selectors: ");
+    report.appendNumber(fallbackCount);
+    report.append('\n');
+    return report.toString();
+}
+#endif
+
 String Internals::counterValue(Element* element)
 {
     if (!element)
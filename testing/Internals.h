@@ -41,6 +41,7 @@
 
 namespace WebCore {
 
+class CSSStyleSheet;
 class ClientRect;
 class ClientRectList;
 class DOMStringList;
@@ -53,6 +54,7 @@ class InspectorFrontendChannelDummy;
 class InternalSettings;
 class MallocStatistics;
 class MemoryInfo;
+class MutationObserver;
 class Node;
 class Page;
 class Range;
@@ -222,10 +224,34 @@ public:
     void insertAuthorCSS(const String&, ExceptionCode&) const;
     void insertUserCSS(const String&, ExceptionCode&) const;
 
+#if ENABLE(CSS_SELECTOR_JIT)
+    String selectorCompilationReport(CSSStyleSheet*, ExceptionCode&) const;
+#endif
+
     const ProfilesArray& consoleProfiles() const;
 
     unsigned numberOfLiveNodes() const;
     unsigned numberOfLiveDocuments() const;
+    unsigned invalidatedElementCount() const;
+    unsigned styleChangedElementCount() const;
+    unsigned styleSharingAttemptCount() const;
+    unsigned styleSharingHitCount() const;
+    unsigned styleSharingIndexHitCount() const;
+    unsigned matchedPropertiesCacheHitCount() const;
+    unsigned matchedPropertiesCacheMissCount() const;
+    unsigned matchedPropertiesCacheSize() const;
+    unsigned matchedPropertiesCacheSizeInBytes() const;
+    unsigned simpleLineLayoutFlowCount() const;
+    unsigned simpleLineLayoutAvoidanceCount(const String& reason) const;
+    unsigned mutationObserverEnqueuedRecordCount(MutationObserver*) const;
+    unsigned mutationObserverCoalescedRecordCount(MutationObserver*) const;
+    unsigned mutationObserverDroppedRecordCount(MutationObserver*) const;
+    unsigned mutationObserverQueuedRecordBytes(MutationObserver*) const;
+    unsigned selectorQueryIndexHitCount() const;
+    unsigned selectorQueryIndexBuildCount() const;
+    unsigned parserPumpSessionCount() const;
+    unsigned parserPumpedTokenCount() const;
+    unsigned parserYieldCount(const String& reason) const;
 
 #if ENABLE(INSPECTOR)
     Vector<String> consoleMessageArgumentCounts() const;